@@ -22,6 +22,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/clusters/network-commissioning/network-commissioning.h>
 #include <app/server/Dnssd.h>
+#include <app/server/MappedEventLogStorage.h>
 #include <app/server/OnboardingCodesUtil.h>
 #include <app/server/Server.h>
 #include <app/util/endpoint-config-api.h>
@@ -587,6 +588,26 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
 
     initParams.testEventTriggerDelegate = &sTestEventTriggerDelegate;
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    if (LinuxDeviceOptions::GetInstance().eventLogFile != nullptr)
+    {
+        static chip::app::MappedEventLogStorage sEventLogStorage;
+        const uint32_t eventBufferSizes[] = { CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE,
+                                              CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE,
+                                              CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE };
+        CHIP_ERROR err = sEventLogStorage.Open(LinuxDeviceOptions::GetInstance().eventLogFile, eventBufferSizes);
+        if (err == CHIP_NO_ERROR)
+        {
+            initParams.eventLogStorageResources = sEventLogStorage.GetLogStorageResources();
+        }
+        else
+        {
+            ChipLogError(NotSpecified, "Failed to open the event log file, using in-memory buffers: %" CHIP_ERROR_FORMAT,
+                         err.Format());
+        }
+    }
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
     // We need to set DeviceInfoProvider before Server::Init to setup the storage of DeviceInfoProvider properly.
     DeviceLayer::SetDeviceInfoProvider(&gExampleDeviceInfoProvider);
 
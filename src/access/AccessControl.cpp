@@ -190,6 +190,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        InvalidateDecisionCache();
     }
 
     return retval;
@@ -201,6 +202,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    InvalidateDecisionCache();
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -217,6 +219,8 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
 
     ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
 
+    InvalidateDecisionCache();
+
     size_t i = 0;
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
 
@@ -234,6 +238,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
+    InvalidateDecisionCache();
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
@@ -248,6 +253,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
     {
         p = &entry;
     }
+    InvalidateDecisionCache();
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
     if (p && p->HasDefaultDelegate())
     {
@@ -355,11 +361,34 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    {
+        bool allowed = false;
+        if (FindCachedDecision(subjectDescriptor, requestPath, requestPrivilege, allowed))
+        {
+            if (!allowed)
+            {
+                ChipLogProgress(DataManagement, "AccessControl: denied (cached)");
+                return CHIP_ERROR_ACCESS_DENIED;
+            }
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: allowed (cached)");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return CHIP_NO_ERROR;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    // Decisions involving device types are not cached, as the device types on endpoints may change
+    // without the access control list changing.
+    [[maybe_unused]] bool cacheable = true;
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
     Entry entry;
-    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    CHIP_ERROR err;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
     {
         AuthMode authMode = AuthMode::kNone;
         ReturnErrorOnFailure(entry.GetAuthMode(authMode));
@@ -442,10 +471,13 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
                 {
                     continue;
                 }
-                if (target.flags & Entry::Target::kDeviceType &&
-                    !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                if (target.flags & Entry::Target::kDeviceType)
                 {
-                    continue;
+                    cacheable = false;
+                    if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                    {
+                        continue;
+                    }
                 }
                 targetMatched = true;
                 break;
@@ -461,14 +493,72 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         ChipLogProgress(DataManagement, "AccessControl: allowed");
 #endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        if (cacheable)
+        {
+            CacheDecision(subjectDescriptor, requestPath, requestPrivilege, true);
+        }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    // Only cache a denial if all entries were checked.
+    if (cacheable && err == CHIP_ERROR_SENTINEL)
+    {
+        CacheDecision(subjectDescriptor, requestPath, requestPrivilege, false);
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
     // No entry was found which passed all checks: access is denied.
     ChipLogProgress(DataManagement, "AccessControl: denied");
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+void AccessControl::InvalidateDecisionCache()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & decision : mCachedDecisions)
+    {
+        decision.valid = false;
+    }
+    mNextCachedDecision = 0;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+bool AccessControl::FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, bool & allowed) const
+{
+    for (const auto & decision : mCachedDecisions)
+    {
+        const SubjectDescriptor & subject = decision.subjectDescriptor;
+        if (decision.valid && decision.requestPrivilege == requestPrivilege &&
+            decision.requestPath.endpoint == requestPath.endpoint && decision.requestPath.cluster == requestPath.cluster &&
+            subject.fabricIndex == subjectDescriptor.fabricIndex && subject.authMode == subjectDescriptor.authMode &&
+            subject.subject == subjectDescriptor.subject && subject.cats == subjectDescriptor.cats)
+        {
+            allowed = decision.allowed;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AccessControl::CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  Privilege requestPrivilege, bool allowed)
+{
+    CachedDecision & decision  = mCachedDecisions[mNextCachedDecision];
+    decision.subjectDescriptor = subjectDescriptor;
+    decision.requestPath       = requestPath;
+    decision.requestPrivilege  = requestPrivilege;
+    decision.allowed           = allowed;
+    decision.valid             = true;
+    mNextCachedDecision        = (mNextCachedDecision + 1) % CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
 CHIP_ERROR AccessControl::Dump(const Entry & entry)
 {
@@ -1756,6 +1756,56 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckCachedDecisions)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+
+    // Decisions remembered from the first pass must not be given to other subjects, paths or privileges.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege), expectedResult);
+        }
+    }
+
+    ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+
+    constexpr SubjectDescriptor subjectDescriptor = { .fabricIndex = 1,
+                                                      .authMode    = AuthMode::kCase,
+                                                      .subject     = kOperationalNodeId1 };
+    constexpr RequestPath onOffPath               = { .cluster = kOnOffCluster, .endpoint = 1 };
+    constexpr RequestPath levelControlPath        = { .cluster = kLevelControlCluster, .endpoint = 1 };
+
+    EntryData data = { .fabricIndex = 1,
+                       .privilege   = Privilege::kOperate,
+                       .authMode    = AuthMode::kCase,
+                       .subjects    = { kOperationalNodeId1 },
+                       .targets     = { { .flags = Target::kCluster, .cluster = kOnOffCluster } } };
+    EXPECT_EQ(LoadAccessControl(accessControl, &data, 1), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, onOffPath, Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, levelControlPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    // Decisions follow changes to the access control list.
+    data.targets[0].cluster = kLevelControlCluster;
+    {
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, data), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.UpdateEntry(nullptr, 1, 0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, onOffPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, levelControlPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, levelControlPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    EXPECT_EQ(LoadAccessControl(accessControl, &data, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, levelControlPath, Privilege::kOperate), CHIP_NO_ERROR);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -65,6 +65,10 @@ public:
      *    this case, Ember attribute access will happen for the read. This may
      *    involve reading from the attribute store or external attribute
      *    callbacks.
+     *
+     * When built with CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE, returning
+     * CHIP_ERROR_IN_PROGRESS instead suspends the report until the value has been
+     * fetched by an EndpointWorkQueue, see EndpointWork.
      */
     virtual CHIP_ERROR Read(const ConcreteReadAttributePath & aPath, AttributeValueEncoder & aEncoder) = 0;
 
@@ -31,6 +31,8 @@ namespace app {
 ///   - CurrentEncodingListIndex representing the list index that is next
 ///     to be encoded in the output. kInvalidListIndex means that a new list
 ///     encoding has been started.
+///   - ListCursor, an opaque position given by the list generator, from
+///     which it can resume the list at CurrentEncodingListIndex.
 class AttributeEncodeState
 {
 public:
@@ -49,12 +51,14 @@ public:
         else
         {
             mCurrentEncodingListIndex = kInvalidListIndex;
+            mListCursor               = 0;
             mAllowPartialData         = false;
         }
     }
 
     bool AllowPartialData() const { return mAllowPartialData; }
     ListIndex CurrentEncodingListIndex() const { return mCurrentEncodingListIndex; }
+    uint32_t ListCursor() const { return mListCursor; }
 
     AttributeEncodeState & SetAllowPartialData(bool allow)
     {
@@ -68,9 +72,16 @@ public:
         return *this;
     }
 
+    AttributeEncodeState & SetListCursor(uint32_t cursor)
+    {
+        mListCursor = cursor;
+        return *this;
+    }
+
     void Reset()
     {
         mCurrentEncodingListIndex = kInvalidListIndex;
+        mListCursor               = 0;
         mAllowPartialData         = false;
     }
 
@@ -84,6 +95,13 @@ private:
      */
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
 
+    /**
+     * The position, in the terms of the list generator, of the list item at mCurrentEncodingListIndex, as given
+     * to AttributeValueEncoder::ListEncodeHelper::EncodeWithCursor. It lets a generator that is called again
+     * for the next chunk of a list resume from there, instead of walking again over the items already encoded.
+     */
+    uint32_t mListCursor = 0;
+
     /**
      * When an attempt to encode an attribute returns an error, the buffer may contain tailing dirty data
      * (since the put was aborted).  The report engine normally rolls back the buffer to right before encoding
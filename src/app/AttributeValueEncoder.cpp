@@ -59,7 +59,7 @@ CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
         ReturnErrorOnFailure(
             mAttributeReportIBsBuilder.GetWriter()->ReserveBuffer(kEndOfAttributeReportIBByteCount + kEndOfListByteCount));
 
-        mEncodeState.SetCurrentEncodingListIndex(0);
+        mEncodeState.SetCurrentEncodingListIndex(0).SetListCursor(0);
     }
     else
     {
@@ -64,6 +64,32 @@ public:
             return mAttributeValueEncoder.EncodeListItem(std::forward<T>(aArg));
         }
 
+        /**
+         * Get the position from which the list generator should resume the list, for generators that can seek to a
+         * position of their own (e.g. an index in a table) instead of walking over the whole list.
+         *
+         * This is the aNextCursor given to EncodeWithCursor for the last item encoded in previous chunks, or 0 when the
+         * list is encoded from its beginning. The items before that position are considered encoded: the generator must
+         * only encode the items from that position on, each with EncodeWithCursor. This must be called before encoding
+         * any item.
+         *
+         * Generators that do not call this are called for every chunk with the whole list, and the items encoded in
+         * previous chunks are skipped by Encode.
+         */
+        uint32_t ResumeListCursor() const { return mAttributeValueEncoder.ResumeList(); }
+
+        /**
+         * Encode a list item, like Encode, and record aNextCursor as the position from which the list generator
+         * should resume the list after this item.
+         */
+        template <typename T>
+        CHIP_ERROR EncodeWithCursor(T && aArg, uint32_t aNextCursor) const
+        {
+            ReturnErrorOnFailure(Encode(std::forward<T>(aArg)));
+            mAttributeValueEncoder.mEncodeState.SetListCursor(aNextCursor);
+            return CHIP_NO_ERROR;
+        }
+
     private:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
@@ -164,6 +190,14 @@ private:
     friend class ListEncodeHelper;
     friend class TestOnlyAttributeValueEncoderAccessor;
 
+    uint32_t ResumeList()
+    {
+        // The items before the current encoding list index were encoded in previous chunks, and the list generator will
+        // not walk over them again.
+        mCurrentEncodingListIndex = mEncodeState.CurrentEncodingListIndex();
+        return mEncodeState.ListCursor();
+    }
+
     template <typename... Ts>
     CHIP_ERROR EncodeListItem(Ts &&... aArgs)
     {
@@ -70,6 +70,7 @@ private:
     //
     void OnReportBegin() override;
     void OnReportEnd() override;
+    void OnReportPayload(const System::PacketBufferHandle & aPayload) override { return mCallback.OnReportPayload(aPayload); }
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
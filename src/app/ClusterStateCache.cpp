@@ -19,6 +19,9 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+
+#include <algorithm>
+#include <string.h>
 #include <tuple>
 
 namespace chip {
@@ -47,58 +50,162 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+template <typename ClusterIterator>
+ClusterIterator LowerBoundCluster(ClusterIterator begin, ClusterIterator end, EndpointId endpointId, ClusterId clusterId)
+{
+    return std::lower_bound(begin, end, ConcreteClusterPath(endpointId, clusterId),
+                            [](const auto & clusterState, const ConcreteClusterPath & path) {
+                                return std::tie(clusterState.mEndpointId, clusterState.mClusterId) <
+                                    std::tie(path.mEndpointId, path.mClusterId);
+                            });
+}
+
+template <typename AttributeVector>
+auto LowerBoundAttribute(AttributeVector & attributes, AttributeId attributeId)
+{
+    return std::lower_bound(attributes.begin(), attributes.end(), attributeId,
+                            [](const auto & attribute, AttributeId id) { return attribute.first < id; });
+}
+
 } // anonymous namespace
 
+namespace detail {
+
+CHIP_ERROR AttributeDataStore::AddBlock(size_t aSize)
+{
+    Block block;
+    block.mData.Alloc(aSize);
+    VerifyOrReturnError(block.mData.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    block.mSize = aSize;
+    mBlocks.push_back(std::move(block));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AttributeDataStore::Reserve(size_t aSize)
+{
+    return AddBlock(std::max(aSize, static_cast<size_t>(CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE)));
+}
+
+uint8_t * AttributeDataStore::Allocate(size_t aSize)
+{
+    Block * block = mBlocks.empty() ? nullptr : &mBlocks.back();
+    if (block == nullptr || block->mSize - block->mUsed < aSize)
+    {
+        VerifyOrReturnValue(AddBlock(std::max(aSize, static_cast<size_t>(CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE))) ==
+                                CHIP_NO_ERROR,
+                            nullptr);
+        if (aSize > CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE && mBlocks.size() > 1)
+        {
+            // This value fills the new block on its own, keep allocating from the previous one.
+            std::swap(mBlocks[mBlocks.size() - 1], mBlocks[mBlocks.size() - 2]);
+            block = &mBlocks[mBlocks.size() - 2];
+        }
+        else
+        {
+            block = &mBlocks.back();
+        }
+    }
+
+    uint8_t * data = block->mData.Get() + block->mUsed;
+    block->mUsed += aSize;
+    mAllocatedSize += aSize;
+    mLiveSize += aSize;
+    return data;
+}
+
+void AttributeDataStore::Adopt(const System::PacketBufferHandle & aBuffer, size_t aSize)
+{
+    // The values of a report are adopted one after the other, so the buffer is either new or the last one adopted.
+    if (mAdoptedBuffers.empty() || !(mAdoptedBuffers.back() == aBuffer))
+    {
+        mAdoptedBuffers.push_back(aBuffer.Retain());
+        mAllocatedSize += aBuffer->AllocSize();
+    }
+    mLiveSize += aSize;
+}
+
+} // namespace detail
+
 template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::CopyElement(TLV::TLVReader * apData, ByteSpan & aElement)
 {
-    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
     reader.Init(*apData);
     size_t totalBufSize = reader.GetTotalLength();
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
+    if (mElementBuffer.AllocatedSize() < totalBufSize)
+    {
+        mElementBuffer.Alloc(totalBufSize);
+        VerifyOrReturnError(mElementBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    TLV::TLVWriter writer;
+    writer.Init(mElementBuffer.Get(), mElementBuffer.AllocatedSize());
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    aSize = writer.GetLengthWritten();
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    ReturnErrorOnFailure(writer.Finalize());
+    aElement = ByteSpan(mElementBuffer.Get(), writer.GetLengthWritten());
     return CHIP_NO_ERROR;
 }
 
+template <bool CanEnableDataCaching>
+bool ClusterStateCacheT<CanEnableDataCaching>::AdoptElement(TLV::TLVReader * apData, ByteSpan & aElement)
+{
+    ByteSpan encoded;
+    VerifyOrReturnValue(!mReportPayload.IsNull() && apData->GetEncodedElement(encoded) == CHIP_NO_ERROR, false);
+
+    // Values that do not come straight from the message, like the lists reassembled by the buffered reader, are copied.
+    uint8_t * payload = mReportPayload->Start();
+    VerifyOrReturnValue(encoded.data() >= payload && encoded.data() + encoded.size() <= payload + mReportPayload->DataLength(),
+                        false);
+
+    // The value is the data of an AttributeDataIB, so it has a one byte context tag, which is not allowed outside of a
+    // container. The ReadClient is done with the encoding of the value, so its tag byte becomes the control byte of the
+    // same value with an anonymous tag.
+    VerifyOrReturnValue(TLV::IsContextTag(apData->GetTag()), false);
+    uint8_t * element = payload + (encoded.data() - payload);
+    element[1]        = static_cast<uint8_t>(element[0] & ~TLV::kTLVTagControlMask);
+
+    aElement = ByteSpan(element + 1, encoded.size() - 1);
+    return true;
+}
+
 template <bool CanEnableDataCaching>
 CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                                                  const StatusIB & aStatus)
 {
     AttributeState state;
-    bool endpointIsNew = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
-    {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
-    }
+    //
+    // Since we might potentially be creating a new entry for aPath.mEndpointId that wasn't there before, we need to
+    // check if an entry didn't exist there previously and remember that so that we can appropriately notify our
+    // clients of the addition of a new endpoint.
+    //
+    auto endpointIter  = FindEndpoint(aPath.mEndpointId);
+    bool endpointIsNew = (endpointIter == mCache.end() || endpointIter->mEndpointId != aPath.mEndpointId);
 
     if (apData)
     {
-        uint32_t elementSize = 0;
-        ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
+        ByteSpan element;
+        const bool adopted = mCacheData && mBulkIngestion && AdoptElement(apData, element);
+        if (!adopted)
+        {
+            ReturnErrorOnFailure(CopyElement(apData, element));
+        }
+        const uint32_t elementSize = static_cast<uint32_t>(element.size());
 
         if constexpr (CanEnableDataCaching)
         {
-            if (mCacheData)
+            if (adopted)
+            {
+                mAttributeDataStore.Adopt(mReportPayload, element.size());
+                state.template Set<AttributeData>(AttributeData{ element.data(), elementSize });
+            }
+            else if (mCacheData)
             {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
+                uint8_t * data = mAttributeDataStore.Allocate(element.size());
+                VerifyOrReturnError(data != nullptr, CHIP_ERROR_NO_MEMORY);
+                memcpy(data, element.data(), element.size());
+
+                state.template Set<AttributeData>(AttributeData{ data, elementSize });
             }
             else
             {
@@ -110,11 +217,14 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
             state = elementSize;
         }
 
+        // CommitPendingDataVersion() never adds clusters, so this reference remains valid.
+        ClusterState & clusterState = GetOrCreateClusterState(aPath.mEndpointId, aPath.mClusterId);
+
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        clusterState.mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -135,7 +245,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            clusterState.mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -168,7 +278,17 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    auto & attributes  = GetOrCreateClusterState(aPath.mEndpointId, aPath.mClusterId).mAttributes;
+    auto attributeIter = LowerBoundAttribute(attributes, aPath.mAttributeId);
+    if (attributeIter != attributes.end() && attributeIter->first == aPath.mAttributeId)
+    {
+        ReleaseAttributeData(attributeIter->second);
+        attributeIter->second = std::move(state);
+    }
+    else
+    {
+        attributes.emplace(attributeIter, aPath.mAttributeId, std::move(state));
+    }
 
     if (mCacheData)
     {
@@ -230,6 +350,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
 {
+    CompactAttributeData();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
     mAddedEndpoints.clear();
@@ -244,11 +365,11 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
-    if (lastClusterInfo.mPendingDataVersion.HasValue())
+    auto * lastClusterInfo = FindClusterState(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
+    if (lastClusterInfo != nullptr && lastClusterInfo->mPendingDataVersion.HasValue())
     {
-        lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
-        lastClusterInfo.mPendingDataVersion.ClearValue();
+        lastClusterInfo->mCommittedDataVersion = lastClusterInfo->mPendingDataVersion;
+        lastClusterInfo->mPendingDataVersion.ClearValue();
     }
 }
 
@@ -279,9 +400,23 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
         mCallback.OnEndpointAdded(this, endpoint);
     }
 
+    // The element buffer is sized for the largest report received, don't hold on to it between reports.
+    mElementBuffer.Free();
+    mReportPayload = nullptr;
+
     mCallback.OnReportEnd();
 }
 
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::OnReportPayload(const System::PacketBufferHandle & aPayload)
+{
+    if (mCacheData && mBulkIngestion)
+    {
+        mReportPayload = aPayload.Retain();
+    }
+    mCallback.OnReportPayload(aPayload);
+}
+
 template <>
 CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
 {
@@ -299,7 +434,7 @@ CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
+    reader.Init(attributeState->template Get<AttributeData>().mData, attributeState->template Get<AttributeData>().mSize);
     return reader.Next();
 }
 
@@ -327,39 +462,57 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
 }
 
 template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+typename ClusterStateCacheT<CanEnableDataCaching>::NodeState::const_iterator
+ClusterStateCacheT<CanEnableDataCaching>::FindEndpoint(EndpointId endpointId) const
+{
+    // Cluster ids are unsigned, so the lowest one sorts before every cluster of the endpoint.
+    return LowerBoundCluster(mCache.begin(), mCache.end(), endpointId, ClusterId(0));
+}
+
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::NodeState::iterator
+ClusterStateCacheT<CanEnableDataCaching>::LowerBound(EndpointId endpointId, ClusterId clusterId)
 {
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
+    return LowerBoundCluster(mCache.begin(), mCache.end(), endpointId, clusterId);
+}
+
+template <bool CanEnableDataCaching>
+typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching>::FindClusterState(EndpointId endpointId, ClusterId clusterId)
+{
+    auto clusterIter = LowerBound(endpointId, clusterId);
+    if (clusterIter == mCache.end() || clusterIter->mEndpointId != endpointId || clusterIter->mClusterId != clusterId)
     {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
+    return &(*clusterIter);
 }
 
 template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
+typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState &
+ClusterStateCacheT<CanEnableDataCaching>::GetOrCreateClusterState(EndpointId endpointId, ClusterId clusterId)
 {
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
+    auto clusterIter = LowerBound(endpointId, clusterId);
+    if (clusterIter == mCache.end() || clusterIter->mEndpointId != endpointId || clusterIter->mClusterId != clusterId)
     {
-        return nullptr;
+        clusterIter = mCache.emplace(clusterIter, endpointId, clusterId);
     }
+    return *clusterIter;
+}
 
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
+template <bool CanEnableDataCaching>
+const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
+{
+    auto clusterIter = LowerBoundCluster(mCache.begin(), mCache.end(), endpointId, clusterId);
+    if (clusterIter == mCache.end() || clusterIter->mEndpointId != endpointId || clusterIter->mClusterId != clusterId)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    return &(*clusterIter);
 }
 
 template <bool CanEnableDataCaching>
@@ -373,8 +526,8 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
         return nullptr;
     }
 
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
+    auto attributeState = LowerBoundAttribute(clusterState->mAttributes, attributeId);
+    if (attributeState == clusterState->mAttributes.end() || attributeState->first != attributeId)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
@@ -384,6 +537,57 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
     return &attributeState->second;
 }
 
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::ReleaseAttributeData(const AttributeState & state)
+{
+    if constexpr (CanEnableDataCaching)
+    {
+        if (state.template Is<AttributeData>())
+        {
+            mAttributeDataStore.Release(state.template Get<AttributeData>().mSize);
+        }
+    }
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::ReleaseAttributeData(const ClusterState & clusterState)
+{
+    for (const auto & attribute : clusterState.mAttributes)
+    {
+        ReleaseAttributeData(attribute.second);
+    }
+}
+
+template <bool CanEnableDataCaching>
+void ClusterStateCacheT<CanEnableDataCaching>::CompactAttributeData()
+{
+    if constexpr (CanEnableDataCaching)
+    {
+        VerifyOrReturn(mAttributeDataStore.ShouldCompact());
+
+        // Failing to compact is fine: the current store still holds all the values.
+        detail::AttributeDataStore compacted;
+        VerifyOrReturn(mAttributeDataStore.LiveSize() == 0 || compacted.Reserve(mAttributeDataStore.LiveSize()) == CHIP_NO_ERROR);
+
+        for (auto & clusterState : mCache)
+        {
+            for (auto & attribute : clusterState.mAttributes)
+            {
+                if (attribute.second.template Is<AttributeData>())
+                {
+                    // This cannot fail, the space was reserved above.
+                    auto & data    = attribute.second.template Get<AttributeData>();
+                    uint8_t * copy = compacted.Allocate(data.mSize);
+                    memcpy(copy, data.mData, data.mSize);
+                    data.mData = copy;
+                }
+            }
+        }
+
+        mAttributeDataStore = std::move(compacted);
+    }
+}
+
 template <bool CanEnableDataCaching>
 const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
 ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
@@ -501,62 +705,50 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
+    for (auto const & clusterState : mCache)
     {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+        if (!clusterState.mCommittedDataVersion.HasValue())
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
-            {
-                continue;
-            }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
+            continue;
+        }
+        DataVersion dataVersion = clusterState.mCommittedDataVersion.Value();
+        size_t clusterSize      = 0;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+        for (auto const & attribute : clusterState.mAttributes)
+        {
+            if constexpr (CanEnableDataCaching)
             {
-                if constexpr (CanEnableDataCaching)
+                if (attribute.second.template Is<StatusIB>())
                 {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
-                    {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
-                    }
-                    else
-                    {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
-                    }
+                    clusterSize += SizeOfStatusIB(attribute.second.template Get<StatusIB>());
+                }
+                else if (attribute.second.template Is<uint32_t>())
+                {
+                    clusterSize += attribute.second.template Get<uint32_t>();
                 }
                 else
                 {
-                    clusterSize += attributeIter.second;
+                    VerifyOrDie(attribute.second.template Is<AttributeData>());
+                    // The stored value is exactly one TLV element.
+                    clusterSize += attribute.second.template Get<AttributeData>().mSize;
                 }
             }
-
-            if (clusterSize == 0)
+            else
             {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
-                continue;
+                clusterSize += attribute.second;
             }
+        }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
-
-            aVector.push_back(std::make_pair(filter, clusterSize));
+        if (clusterSize == 0)
+        {
+            // No data in this cluster, so no point in sending a dataVersion
+            // along at all.
+            continue;
         }
+
+        DataVersionFilter filter(clusterState.mEndpointId, clusterState.mClusterId, dataVersion);
+
+        aVector.push_back(std::make_pair(filter, clusterSize));
     }
 
     std::sort(aVector.begin(), aVector.end(),
@@ -651,42 +843,48 @@ exit:
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
 {
-    mCache.erase(endpointId);
+    // The clusters of an endpoint are contiguous, so they are all removed at once.
+    auto first = FindEndpoint(endpointId);
+    auto last  = first;
+    for (; last != mCache.end() && last->mEndpointId == endpointId; ++last)
+    {
+        ReleaseAttributeData(*last);
+    }
+    mCache.erase(first, last);
 }
 
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
-    // Can't use GetEndpointState here, since that only handles const things.
-    auto endpointIter = mCache.find(cluster.mEndpointId);
-    if (endpointIter == mCache.end())
+    auto clusterIter = LowerBound(cluster.mEndpointId, cluster.mClusterId);
+    if (clusterIter == mCache.end() || clusterIter->mEndpointId != cluster.mEndpointId ||
+        clusterIter->mClusterId != cluster.mClusterId)
     {
         return;
     }
 
-    auto & endpointState = endpointIter->second;
-    endpointState.erase(cluster.mClusterId);
+    ReleaseAttributeData(*clusterIter);
+    mCache.erase(clusterIter);
 }
 
 template <bool CanEnableDataCaching>
 void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
-    // Can't use GetClusterState here, since that only handles const things.
-    auto endpointIter = mCache.find(attribute.mEndpointId);
-    if (endpointIter == mCache.end())
+    auto * clusterState = FindClusterState(attribute.mEndpointId, attribute.mClusterId);
+    if (clusterState == nullptr)
     {
         return;
     }
 
-    auto & endpointState = endpointIter->second;
-    auto clusterIter     = endpointState.find(attribute.mClusterId);
-    if (clusterIter == endpointState.end())
+    auto & attributes  = clusterState->mAttributes;
+    auto attributeIter = LowerBoundAttribute(attributes, attribute.mAttributeId);
+    if (attributeIter == attributes.end() || attributeIter->first != attribute.mAttributeId)
     {
         return;
     }
 
-    auto & clusterState = clusterIter->second;
-    clusterState.mAttributes.erase(attribute.mAttributeId);
+    ReleaseAttributeData(attributeIter->second);
+    attributes.erase(attributeIter);
 }
 
 template <bool CanEnableDataCaching>
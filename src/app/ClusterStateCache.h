@@ -27,16 +27,94 @@
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/Variant.h>
 #include <list>
 #include <map>
 #include <queue>
 #include <set>
+#include <utility>
 #include <vector>
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
 namespace chip {
 namespace app {
+
+namespace detail {
+
+/*
+ * Storage for the attribute values held by a ClusterStateCache.
+ *
+ * Values are carved out of blocks of CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE bytes instead of getting a heap
+ * allocation each, or read in place from the report buffers adopted by the store. A value never moves once allocated,
+ * so the space of released values is only reclaimed by replacing the whole store with a compacted copy (see
+ * ShouldCompact()), which holds all the values in blocks.
+ */
+class AttributeDataStore
+{
+public:
+    AttributeDataStore() = default;
+
+    AttributeDataStore(const AttributeDataStore &)             = delete;
+    AttributeDataStore & operator=(const AttributeDataStore &) = delete;
+    AttributeDataStore(AttributeDataStore &&)                  = default;
+    AttributeDataStore & operator=(AttributeDataStore &&)      = default;
+
+    /*
+     * Allocate a single block that can hold aSize bytes of values. This is meant to be called on an empty store that
+     * is about to receive a known amount of data, so that Allocate() cannot fail until that amount is reached.
+     */
+    CHIP_ERROR Reserve(size_t aSize);
+
+    /*
+     * Returns space for a value of aSize bytes, or nullptr if no memory is available.
+     */
+    uint8_t * Allocate(size_t aSize);
+
+    /*
+     * Keep aBuffer for as long as the store, so that a value of aSize bytes can be read from it in place. The whole
+     * buffer counts as allocated, so that the store gets compacted once the buffer mostly holds released values.
+     */
+    void Adopt(const System::PacketBufferHandle & aBuffer, size_t aSize);
+
+    /*
+     * Record that a value of aSize bytes returned by Allocate() is no longer used.
+     */
+    void Release(size_t aSize) { mLiveSize -= aSize; }
+
+    /*
+     * The total size of the values that have been allocated and not released.
+     */
+    size_t LiveSize() const { return mLiveSize; }
+
+    /*
+     * Whether enough space is held by released values that the store should be compacted.
+     */
+    bool ShouldCompact() const
+    {
+        const size_t releasedSize = mAllocatedSize - mLiveSize;
+        return releasedSize >= CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE && releasedSize > mLiveSize;
+    }
+
+private:
+    struct Block
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> mData;
+        size_t mSize = 0;
+        size_t mUsed = 0;
+    };
+
+    CHIP_ERROR AddBlock(size_t aSize);
+
+    // The last block is the one values are allocated from; blocks of oversized values are inserted before it.
+    std::vector<Block> mBlocks;
+    std::vector<System::PacketBufferHandle> mAdoptedBuffers;
+    size_t mAllocatedSize = 0;
+    size_t mLiveSize      = 0;
+};
+
+} // namespace detail
+
 /*
  * This implements a cluster state cache designed to aggregate both attribute and event data received by a client
  * from either read or subscribe interactions and keep it resident and available for clients to
@@ -55,7 +133,9 @@ namespace app {
  * For events, functions that permit iteration over the cached events sorted by event number are provided.
  *
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
- * to de-serialize the state on-demand.
+ * to de-serialize the state on-demand. Clusters are kept in a vector sorted by endpoint and cluster id, each with a
+ * vector of its attributes sorted by attribute id, and the attribute values are packed into a few large buffers
+ * rather than allocated one by one.
  *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
@@ -135,6 +215,21 @@ public:
      */
     ReadClient::Callback & GetBufferedCallback() { return mBufferedReader; }
 
+    /*
+     * Enable or disable bulk ingestion of reports, which is disabled by default.
+     *
+     * In this mode, attribute values are not copied out of the report data messages they are received in: the cache
+     * keeps the message buffers and reads the values from them in place. This makes large reports, such as the priming
+     * reports of a subscription to a whole node, much cheaper to ingest, at the cost of holding on to whole message
+     * buffers until their values are replaced and the cache is compacted at the start of a later report. It is not
+     * meant for platforms where packet buffers come from a small fixed pool.
+     *
+     * Lists are reassembled by the buffered reader before they reach the cache, so they are still copied.
+     *
+     * This has no effect if the cache does not store data.
+     */
+    void SetBulkIngestion(bool enable) { mBulkIngestion = enable; }
+
     /*
      * Retrieve the value of an attribute from the cache (if present) given a concrete path by decoding
      * it using DataModel::Decode into the in-out argument 'value'.
@@ -260,8 +355,8 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * The underlying TLV buffer only remains valid until the cached value for that path is updated or the cache
+     * starts processing another report, so it must not be held across any async call boundaries.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -377,9 +472,9 @@ public:
         auto clusterState = GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
-        for (auto & attributeIter : clusterState->mAttributes)
+        for (auto & attribute : clusterState->mAttributes)
         {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
+            const ConcreteAttributePath path(endpointId, clusterId, attribute.first);
             ReturnErrorOnFailure(func(path));
         }
 
@@ -402,17 +497,14 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
+        for (auto & clusterState : mCache)
         {
-            for (auto & clusterIter : endpointIter.second)
+            if (clusterState.mClusterId == clusterId)
             {
-                if (clusterIter.first == clusterId)
+                for (auto & attribute : clusterState.mAttributes)
                 {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
+                    const ConcreteAttributePath path(clusterState.mEndpointId, clusterId, attribute.first);
+                    ReturnErrorOnFailure(func(path));
                 }
             }
         }
@@ -435,13 +527,10 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        for (auto clusterIter = FindEndpoint(endpointId); clusterIter != mCache.end() && clusterIter->mEndpointId == endpointId;
+             ++clusterIter)
         {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
+            ReturnErrorOnFailure(func(clusterIter->mClusterId));
         }
         return CHIP_NO_ERROR;
     }
@@ -560,7 +649,13 @@ private:
     // The data for a single attribute is not going to be gigabytes in size, so
     // using uint32_t for the size is fine; on 64-bit systems this can save
     // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    //
+    // The TLV of an attribute value lives in mAttributeDataStore.
+    struct AttributeData
+    {
+        const uint8_t * mData = nullptr;
+        uint32_t mSize        = 0;
+    };
     using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
@@ -569,12 +664,15 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterState(EndpointId endpointId, ClusterId clusterId) : mEndpointId(endpointId), mClusterId(clusterId) {}
+
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        std::vector<std::pair<AttributeId, AttributeState>> mAttributes; // Sorted by attribute id.
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using NodeState = std::vector<ClusterState>; // Sorted by endpoint id, then cluster id.
 
     struct Comparator
     {
@@ -610,13 +708,33 @@ private:
      *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
      *
      */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
     const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
     const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
                                              CHIP_ERROR & err) const;
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
+    /*
+     * Returns the first cluster of the given endpoint, or the position where it would be inserted if the endpoint
+     * has no cluster.
+     */
+    typename NodeState::const_iterator FindEndpoint(EndpointId endpointId) const;
+
+    /*
+     * Returns the given cluster, or the position where it would be inserted if it is not in the cache.
+     */
+    typename NodeState::iterator LowerBound(EndpointId endpointId, ClusterId clusterId);
+
+    ClusterState * FindClusterState(EndpointId endpointId, ClusterId clusterId);
+    ClusterState & GetOrCreateClusterState(EndpointId endpointId, ClusterId clusterId);
+
+    // Give back the space used by the value of an attribute that is being replaced or removed.
+    void ReleaseAttributeData(const AttributeState & state);
+    void ReleaseAttributeData(const ClusterState & clusterState);
+
+    // Move the cached values to a new store if too much of the current one is taken by released values.
+    void CompactAttributeData();
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -637,8 +755,13 @@ private:
     //
     void OnReportBegin() override;
     void OnReportEnd() override;
+    void OnReportPayload(const System::PacketBufferHandle & aPayload) override;
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
-    void OnError(CHIP_ERROR aError) override { return mCallback.OnError(aError); }
+    void OnError(CHIP_ERROR aError) override
+    {
+        mReportPayload = nullptr;
+        return mCallback.OnError(aError);
+    }
 
     void OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus) override;
 
@@ -685,10 +808,18 @@ private:
     // on the wire if not all filters can be applied.
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
-    CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
+    // Copy the element apData is positioned on, with an anonymous tag, into mElementBuffer.
+    CHIP_ERROR CopyElement(TLV::TLVReader * apData, ByteSpan & aElement);
+
+    // Turn the element apData is positioned on into an element with an anonymous tag, in place in mReportPayload.
+    // Returns false if the element is not read from mReportPayload.
+    bool AdoptElement(TLV::TLVReader * apData, ByteSpan & aElement);
 
     Callback & mCallback;
     NodeState mCache;
+    detail::AttributeDataStore mAttributeDataStore;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mElementBuffer;
+    System::PacketBufferHandle mReportPayload; // The message being processed, only kept for bulk ingestion.
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
@@ -699,6 +830,7 @@ private:
     BufferedReadCallback mBufferedReader;
     ConcreteClusterPath mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     const bool mCacheData                   = CanEnableDataCaching;
+    bool mBulkIngestion                     = false;
 };
 
 using ClusterStateCache       = ClusterStateCacheT<true>;
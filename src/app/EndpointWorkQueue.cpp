@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EndpointWorkQueue.h>
+
+#include <app/InteractionModelEngine.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+class PlatformScheduler : public EndpointWorkQueue::Scheduler
+{
+public:
+    CHIP_ERROR ScheduleBackgroundWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) override
+    {
+        return DeviceLayer::PlatformMgr().ScheduleBackgroundWork(aWork, aArg);
+    }
+
+    CHIP_ERROR ScheduleWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) override
+    {
+        return DeviceLayer::PlatformMgr().ScheduleWork(aWork, aArg);
+    }
+};
+
+PlatformScheduler sPlatformScheduler;
+
+} // namespace
+
+EndpointWorkQueue::EndpointWorkQueue() : EndpointWorkQueue(sPlatformScheduler) {}
+
+void EndpointWorkQueue::Enqueue(EndpointId endpointId, EndpointWork & work)
+{
+    assertChipStackLockedByCurrentThread();
+    VerifyOrDie(work.mQueue == nullptr);
+
+    work.mQueue      = this;
+    work.mEndpointId = endpointId;
+    mPending.PushBack(&work);
+    StartWork();
+}
+
+bool EndpointWorkQueue::IsRunningWorkFor(EndpointId endpointId)
+{
+    for (auto & work : mRunning)
+    {
+        if (work.mEndpointId == endpointId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void EndpointWorkQueue::StartWork()
+{
+    // Hand back again the work whose completion could not be scheduled on the event loop. Completions always go through
+    // the event loop, so that OnWorkDone is never called from within Enqueue, e.g. in the middle of building a report.
+    for (auto & work : mRunning)
+    {
+        if (work.mDoneUnreported.exchange(false) &&
+            mScheduler.ScheduleWork(WorkDone, reinterpret_cast<intptr_t>(&work)) != CHIP_NO_ERROR)
+        {
+            work.mDoneUnreported.store(true);
+        }
+    }
+
+    auto it = mPending.begin();
+    while (it != mPending.end() && mRunningCount < kMaxRunningWork)
+    {
+        EndpointWork & work = *it;
+        ++it;
+
+        // Keep the order of the work of an endpoint: later work waits for the running one, and so does the work queued
+        // after it for the same endpoint, since it comes later in mPending.
+        if (IsRunningWorkFor(work.mEndpointId))
+        {
+            continue;
+        }
+
+        mPending.Remove(&work);
+        mRunning.PushBack(&work);
+        mRunningCount++;
+
+        CHIP_ERROR err = mScheduler.ScheduleBackgroundWork(RunWork, reinterpret_cast<intptr_t>(&work));
+        if (err != CHIP_NO_ERROR)
+        {
+            // Do not lose the work: run it here, as it would have been without the queue.
+            ChipLogError(DataManagement, "Failed to schedule work for endpoint %u: %" CHIP_ERROR_FORMAT, work.mEndpointId,
+                         err.Format());
+            RunWork(reinterpret_cast<intptr_t>(&work));
+        }
+    }
+}
+
+void EndpointWorkQueue::RunWork(intptr_t arg)
+{
+    auto * work = reinterpret_cast<EndpointWork *>(arg);
+    work->Run();
+
+    // Hand the work back to the event loop, which owns the queue.
+    CHIP_ERROR err = work->mQueue->mScheduler.ScheduleWork(WorkDone, arg);
+    if (err != CHIP_NO_ERROR)
+    {
+        // This may run on the event loop, so the stack lock cannot be taken here. Leave the work to be handed back again
+        // the next time work is queued or done.
+        ChipLogError(DataManagement, "Failed to complete work for endpoint %u: %" CHIP_ERROR_FORMAT, work->mEndpointId,
+                     err.Format());
+        work->mDoneUnreported.store(true);
+    }
+}
+
+void EndpointWorkQueue::WorkDone(intptr_t arg)
+{
+    auto * work               = reinterpret_cast<EndpointWork *>(arg);
+    EndpointWorkQueue * queue = work->mQueue;
+
+    queue->mRunning.Remove(work);
+    queue->mRunningCount--;
+    work->mQueue = nullptr;
+
+    // The work may be destroyed by OnWorkDone.
+    work->OnWorkDone();
+
+    // Retry the reads that were waiting for work to be done.
+    InteractionModelEngine::GetInstance()->GetReportingEngine().ResumeSuspendedReports();
+    queue->StartWork();
+}
+
+} // namespace app
+} // namespace chip
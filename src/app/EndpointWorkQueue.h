@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/IntrusiveList.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/CHIPDeviceEvent.h>
+
+#include <atomic>
+#include <stddef.h>
+
+namespace chip {
+namespace app {
+
+class EndpointWorkQueue;
+
+/**
+ * A piece of work for an endpoint that may be slow, e.g. a call into a bridged device, to run off the Matter event
+ * loop through an EndpointWorkQueue.
+ *
+ * A command handler can, for instance, keep a CommandHandler::Handle in its work, and add the command status or
+ * response to it in OnWorkDone: the invoke response is sent once all the handles of the interaction are released, so
+ * the results of the commands of a batched invoke are merged into one response as usual.
+ *
+ * An attribute read can queue work that fetches the value, and return CHIP_ERROR_IN_PROGRESS until the fetched value is
+ * available: the report is suspended at that attribute, after sending what was encoded before it, and is retried from
+ * there once the work is done (see reporting::Engine::ResumeSuspendedReports). The read must keep returning
+ * CHIP_ERROR_IN_PROGRESS, without queuing the work again, while the work is still pending.
+ */
+class EndpointWork : public IntrusiveListNodeBase<>
+{
+public:
+    virtual ~EndpointWork() = default;
+
+    /**
+     * Do the work. Called on a platform background task, without the Matter stack lock held, so it must not use the
+     * Matter stack or data model.
+     */
+    virtual void Run() = 0;
+
+    /**
+     * Called on the Matter event loop, with the Matter stack lock held, once Run has returned. The work is no longer
+     * used by the queue and may be destroyed from here.
+     */
+    virtual void OnWorkDone() = 0;
+
+    EndpointId GetEndpointId() const { return mEndpointId; }
+
+private:
+    friend class EndpointWorkQueue;
+
+    EndpointWorkQueue * mQueue = nullptr;
+    EndpointId mEndpointId     = kInvalidEndpointId;
+    // Set when Run has returned but OnWorkDone could not be scheduled on the event loop.
+    std::atomic<bool> mDoneUnreported{ false };
+};
+
+/**
+ * Runs EndpointWork on the platform background tasks (see PlatformManager::ScheduleBackgroundWork), so that slow work
+ * for one endpoint does not block reports and commands for the other endpoints.
+ *
+ * The work of an endpoint runs one item at a time, in the order it was queued. The work of different endpoints runs
+ * concurrently, on at most kMaxRunningWork background tasks at a time. On platforms without background tasks, the work
+ * runs on the Matter event loop, as if it had been called directly.
+ *
+ * All the methods must be called on the Matter event loop, or with the Matter stack lock held. The queue must outlive
+ * the work queued on it.
+ */
+class EndpointWorkQueue
+{
+public:
+    static constexpr size_t kMaxRunningWork = CHIP_DEVICE_CONFIG_BG_TASK_COUNT;
+
+    /**
+     * Where the queue runs the work. The default scheduler uses the PlatformManager: it runs the work on the platform
+     * background tasks and hands it back to the Matter event loop.
+     */
+    class Scheduler
+    {
+    public:
+        virtual ~Scheduler() = default;
+
+        /// Run aWork(aArg) off the Matter event loop.
+        virtual CHIP_ERROR ScheduleBackgroundWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) = 0;
+
+        /// Run aWork(aArg) on the Matter event loop. May be called from any thread.
+        virtual CHIP_ERROR ScheduleWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) = 0;
+    };
+
+    EndpointWorkQueue();
+    explicit EndpointWorkQueue(Scheduler & scheduler) : mScheduler(scheduler) {}
+
+    EndpointWorkQueue(const EndpointWorkQueue &)             = delete;
+    EndpointWorkQueue & operator=(const EndpointWorkQueue &) = delete;
+
+    /**
+     * Queue work for an endpoint. The work must stay alive, and must not be queued again, until its OnWorkDone is
+     * called.
+     */
+    void Enqueue(EndpointId endpointId, EndpointWork & work);
+
+    /// Whether any work is queued or running.
+    bool HasPendingWork() const { return !mPending.Empty() || !mRunning.Empty(); }
+
+private:
+    static void RunWork(intptr_t arg);
+    static void WorkDone(intptr_t arg);
+
+    bool IsRunningWorkFor(EndpointId endpointId);
+    void StartWork();
+
+    Scheduler & mScheduler;
+    IntrusiveList<EndpointWork> mPending; // In the order the work was queued.
+    IntrusiveList<EndpointWork> mRunning;
+    size_t mRunningCount = 0;
+};
+
+} // namespace app
+} // namespace chip
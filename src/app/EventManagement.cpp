@@ -66,6 +66,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mMovedEventNumber       = 0;
 };
 
 /**
@@ -108,7 +109,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 
         current = &apCircularEventBuffer[bufferIndex];
         current->Init(apLogStorageResources[bufferIndex].mpBuffer, apLogStorageResources[bufferIndex].mBufferSize, prev, next,
-                      apLogStorageResources[bufferIndex].mPriority);
+                      apLogStorageResources[bufferIndex].mPriority, apLogStorageResources[bufferIndex].mpState);
 
         prev = current;
 
@@ -126,7 +127,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
     mMonotonicStartupTime = aMonotonicStartupTime;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -155,11 +156,14 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->IndexAppendedEvent(aEventNumber, writer.GetLengthWritten());
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
         *nextBuffer = backup;
+        nextBuffer->SaveState();
     }
     return err;
 }
@@ -217,7 +221,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mMovedEventNumber);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
@@ -469,6 +473,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     SuccessOrExit(err);
 
     mBytesWritten += writer.GetLengthWritten();
+    mpEventBuffer->IndexAppendedEvent(ctxt.mCurrentEventNumber, writer.GetLengthWritten());
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -655,6 +660,8 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
+    SeekEventReader(reader, bufWrapper, aEventMin);
+
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
@@ -676,6 +683,66 @@ exit:
     return err;
 }
 
+void EventManagement::SeekEventReader(TLVReader & aReader, CircularEventBufferWrapper & aBufWrapper, EventNumber aEventNumber)
+{
+    // The lowest priority buffer holds the most recent events, so the first buffer with a matching indexed event holds the
+    // closest one.
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        EventNumber indexedEventNumber;
+        uint32_t offset;
+        if (!buffer->FindIndexedEvent(aEventNumber, indexedEventNumber, offset))
+        {
+            continue;
+        }
+
+        CircularEventBuffer * const startBuffer = aBufWrapper.mpCurrent;
+        aBufWrapper.mpCurrent                   = buffer;
+        aBufWrapper.mStartOffset                = offset;
+
+        CircularEventReader circularReader;
+        circularReader.Init(&aBufWrapper);
+        aReader.Init(circularReader);
+
+        // The index is only a hint: if it does not match the buffer content, read all the events.
+        EventNumber eventNumber;
+        if (PeekEventNumber(aReader, eventNumber) != CHIP_NO_ERROR || eventNumber != indexedEventNumber)
+        {
+            ChipLogError(EventLogging, "Event index out of sync with event buffer with priority %u",
+                         static_cast<unsigned>(buffer->GetPriority()));
+            aBufWrapper.mpCurrent    = startBuffer;
+            aBufWrapper.mStartOffset = 0;
+            circularReader.Init(&aBufWrapper);
+            aReader.Init(circularReader);
+        }
+        return;
+    }
+}
+
+CHIP_ERROR EventManagement::PeekEventNumber(const TLVReader & aReader, EventNumber & aEventNumber)
+{
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+    EventEnvelopeContext context;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+
+    CHIP_ERROR err = TLV::Utilities::Iterate(reader, FetchEventParameters, &context, false /*recurse*/);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    aEventNumber = context.mEventNumber;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -841,6 +908,7 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     // event is not getting dropped. Note how much space it requires, and return.
     ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mMovedEventNumber         = context.mEventNumber;
     return CHIP_END_OF_TLV;
 }
 
@@ -851,12 +919,112 @@ void EventManagement::SetScheduledEventInfo(EventNumber & aEventNumber, uint32_t
 }
 
 void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev,
-                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
+                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel, CircularEventBufferState * apState)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev         = apPrev;
+    mpNext         = apNext;
+    mPriority      = aPriorityLevel;
+    mpState        = apState;
+    mIndexStart    = 0;
+    mIndexCount    = 0;
+    mAppendedBytes = 0;
+
+    if (mpState != nullptr)
+    {
+        RestoreState();
+    }
+}
+
+void CircularEventBuffer::RestoreState()
+{
+    CHIP_ERROR err = TLVCircularBuffer::Init(GetQueue(), GetTotalDataLength(), mpState->mHeadOffset, mpState->mDataLength);
+
+    // The process may have stopped in the middle of an update, so only keep the events if the state covers whole events.
+    if (err == CHIP_NO_ERROR)
+    {
+        CircularTLVReader reader;
+        reader.Init(*this);
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            VerifyOrExit(reader.GetType() == kTLVType_Structure, err = CHIP_ERROR_WRONG_TLV_TYPE);
+        }
+        if (err == CHIP_END_OF_TLV && reader.GetLengthRead() == DataLength())
+        {
+            err = CHIP_NO_ERROR;
+        }
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Dropping stored events with priority %u: %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(mPriority), err.Format());
+        TLVCircularBuffer::Init(GetQueue(), GetTotalDataLength());
+    }
+
+    // The restored events are not indexed; event lookups fall back to scanning them.
+    mAppendedBytes = DataLength();
+    SaveState();
+}
+
+void CircularEventBuffer::SaveState()
+{
+    VerifyOrReturn(mpState != nullptr);
+    mpState->mHeadOffset = static_cast<uint32_t>(QueueHead() - GetQueue());
+    mpState->mDataLength = DataLength();
+}
+
+void CircularEventBuffer::PruneIndex()
+{
+    // Positions are compared modulo 2^32: an entry is in the buffer if it lies within DataLength() bytes of the head.
+    const uint32_t headPosition = mAppendedBytes - DataLength();
+    while (mIndexCount > 0 && IndexEntryAt(0).mPosition - headPosition >= DataLength())
+    {
+        mIndexStart = static_cast<uint8_t>((mIndexStart + 1) % kIndexSize);
+        mIndexCount--;
+    }
+}
+
+void CircularEventBuffer::IndexAppendedEvent(EventNumber aEventNumber, uint32_t aEventSize)
+{
+    const uint32_t position = mAppendedBytes;
+    mAppendedBytes += aEventSize;
+
+    VerifyOrReturn(CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0);
+    PruneIndex();
+
+    // Spread the entries over the buffer, so that they cover all the events it can hold.
+    if (mIndexCount > 0)
+    {
+        const uint32_t lastPosition = IndexEntryAt(static_cast<uint8_t>(mIndexCount - 1)).mPosition;
+        VerifyOrReturn(position - lastPosition >= GetTotalDataLength() / kIndexSize);
+    }
+    if (mIndexCount == kIndexSize)
+    {
+        mIndexStart = static_cast<uint8_t>((mIndexStart + 1) % kIndexSize);
+        mIndexCount--;
+    }
+    IndexEntryAt(mIndexCount) = { aEventNumber, position };
+    mIndexCount++;
+}
+
+bool CircularEventBuffer::FindIndexedEvent(EventNumber aEventNumber, EventNumber & aIndexedEventNumber, uint32_t & aOffset)
+{
+    PruneIndex();
+
+    // Entries are sorted by event number, and there are only a few of them.
+    for (uint8_t i = mIndexCount; i > 0; i--)
+    {
+        const IndexEntry & entry = IndexEntryAt(static_cast<uint8_t>(i - 1));
+        if (entry.mEventNumber <= aEventNumber)
+        {
+            aIndexedEventNumber = entry.mEventNumber;
+            aOffset             = entry.mPosition - (mAppendedBytes - DataLength());
+            return true;
+        }
+    }
+    return false;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -882,8 +1050,8 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength() - apBufWrapper->mStartOffset);
+    mMaxLen = apBufWrapper->mpCurrent->DataLength() - apBufWrapper->mStartOffset;
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -899,6 +1067,21 @@ CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
+    // Skip the start offset within the first one or two contiguous parts of the current buffer.
+    while (mStartOffset > 0 && aBufLen > 0)
+    {
+        if (mStartOffset < aBufLen)
+        {
+            aBufStart += mStartOffset;
+            aBufLen -= mStartOffset;
+            mStartOffset = 0;
+            break;
+        }
+        mStartOffset -= aBufLen;
+        aBufStart += aBufLen;
+        mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+    }
+
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
     {
         mpCurrent = mpCurrent->GetPreviousCircularEventBuffer();
@@ -76,6 +76,17 @@ inline constexpr size_t kMaxEventSizeReserve            = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+/**
+ * @brief
+ *   The state of a CircularEventBuffer that locates its events in its storage. Keeping it along with the storage,
+ *   e.g. in a memory-mapped file, lets a later CircularEventBuffer over the same storage recover the events.
+ */
+struct CircularEventBufferState
+{
+    uint32_t mHeadOffset; ///< Offset, in bytes, of the oldest event from the start of the storage.
+    uint32_t mDataLength; ///< Length, in bytes, of the events, which wrap around the end of the storage.
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::TLVCircularBuffer
@@ -105,9 +116,14 @@ public:
      *                           events of greater priority.
      *
      * @param[in] aPriorityLevel CircularEventBuffer priority level
+     *
+     * @param[in] apState        Optional. The state of the events already in
+     *                           \c apBuffer, which are then kept, and which
+     *                           is kept up to date as events are added and
+     *                           evicted.
      */
     void Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev, CircularEventBuffer * apNext,
-              PriorityLevel aPriorityLevel);
+              PriorityLevel aPriorityLevel, CircularEventBufferState * apState = nullptr);
 
     /**
      * @brief
@@ -128,9 +144,54 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Record an event that was just appended to the buffer. Its position is added to the buffer index if it is far
+     *   enough from the last indexed event.
+     *
+     * @param[in] aEventNumber  The number of the appended event.
+     * @param[in] aEventSize    The size of the appended event, in bytes.
+     */
+    void IndexAppendedEvent(EventNumber aEventNumber, uint32_t aEventSize);
+
+    /**
+     * @brief
+     *   Find the indexed event with the highest event number not greater than aEventNumber.
+     *
+     * @param[in]  aEventNumber         The event number to look up.
+     * @param[out] aIndexedEventNumber  The number of the indexed event found.
+     * @param[out] aOffset              The offset of the indexed event from the head of the buffer.
+     *
+     * @retval true if such an event is still in the buffer, false otherwise.
+     */
+    bool FindIndexedEvent(EventNumber aEventNumber, EventNumber & aIndexedEventNumber, uint32_t & aOffset);
+
+    /**
+     * @brief
+     *   Update the state given to Init, if any, with the current head and length of the buffer.
+     */
+    void SaveState();
+
     ~CircularEventBuffer() override = default;
 
 private:
+    struct IndexEntry
+    {
+        EventNumber mEventNumber;
+        uint32_t mPosition; ///< Number of bytes appended to the buffer before the event, modulo 2^32.
+    };
+
+    static_assert(CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE <= UINT8_MAX, "Event index is too large");
+    static constexpr uint8_t kIndexSize = CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0 ? CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE : 1;
+
+    // Drop the index entries of the events that were evicted from the buffer.
+    void PruneIndex();
+
+    // Recover the events described by mpState, or start empty if they are not whole events.
+    void RestoreState();
+    void OnQueueChanged() override { SaveState(); }
+    IndexEntry & IndexEntryAt(uint8_t aIndex) { return mIndex[(mIndexStart + aIndex) % kIndexSize]; }
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -139,6 +200,16 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    CircularEventBufferState * mpState = nullptr; ///< Optional state kept along with the storage
+
+    // The event index is a ring of the positions of some of the events in the buffer, in increasing event number order.
+    // Positions are counted in bytes appended to the buffer, so that evicting events or wrapping around the end of the
+    // storage does not invalidate the entries of the events still in the buffer.
+    IndexEntry mIndex[kIndexSize];
+    uint8_t mIndexStart     = 0;
+    uint8_t mIndexCount     = 0;
+    uint32_t mAppendedBytes = 0;
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -155,6 +226,7 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    uint32_t mStartOffset = 0; ///< Offset from the head of mpCurrent at which reading starts
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -187,6 +259,9 @@ struct LogStorageResources
     uint32_t mBufferSize = 0; ///< The size, in bytes, of the `mBuffer`.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    CircularEventBufferState * mpState =
+        nullptr; // Optional. State of the events already in `mpBuffer`, e.g. when it is backed by a file that outlives the
+                 // process. The events are then kept, and the state is kept up to date as events are added and evicted.
 };
 
 /**
@@ -436,9 +511,10 @@ private:
      * @brief copy the event outright to next buffer with higher priority
      *
      * @param[in] apEventBuffer  CircularEventBuffer
+     * @param[in] aEventNumber   The number of the event at the head of apEventBuffer
      *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
 
     /**
      * @brief Ensure that:
@@ -500,6 +576,20 @@ private:
      */
     static CHIP_ERROR FetchEventParameters(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief Position the reader on the last indexed event whose number is not greater than aEventNumber, so that the
+     * events before it are not iterated. The reader is left positioned on the oldest event if there is no such event.
+     *
+     * Events are stored in increasing event number order from the buffer of the highest priority to the buffer of the
+     * lowest priority, so all the skipped events have lower event numbers.
+     */
+    void SeekEventReader(TLV::TLVReader & aReader, CircularEventBufferWrapper & aBufWrapper, EventNumber aEventNumber);
+
+    /**
+     * @brief Read the event number of the event the reader is about to read.
+     */
+    static CHIP_ERROR PeekEventNumber(const TLV::TLVReader & aReader, EventNumber & aEventNumber);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      * First event gets a timestamp, subsequent ones get a delta T
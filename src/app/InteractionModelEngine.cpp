@@ -89,7 +89,7 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     ReturnErrorOnFailure(mpFabricTable->AddFabricDelegate(this));
     ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
 
-    mReportingEngine.Init();
+    ReturnErrorOnFailure(mReportingEngine.Init());
 
     StatusIB::RegisterErrorFormatter();
 
@@ -1542,15 +1542,16 @@ bool InteractionModelEngine::HasConflictWriteRequests(const WriteHandler * apWri
     return false;
 }
 
-void InteractionModelEngine::ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList)
+void InteractionModelEngine::ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
+                                                      ArenaAllocatorBase * apArena)
 {
-    ReleasePool(aAttributePathList, mAttributePathPool);
+    ReleasePool(aAttributePathList, mAttributePathPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
-                                                              AttributePathParams & aAttributePath)
+                                                              AttributePathParams & aAttributePath, ArenaAllocatorBase * apArena)
 {
-    CHIP_ERROR err = PushFront(aAttributePathList, aAttributePath, mAttributePathPool);
+    CHIP_ERROR err = PushFront(aAttributePathList, aAttributePath, mAttributePathPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "AttributePath pool full");
@@ -1559,7 +1560,8 @@ CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(SingleLinkedListNo
     return err;
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths)
+void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                                                  ArenaAllocatorBase * apArena)
 {
     SingleLinkedListNode<AttributePathParams> * prev = nullptr;
     auto * path1                                     = aAttributePaths;
@@ -1599,30 +1601,34 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(SingleLinkedLi
             continue;
         }
 
+        auto * next = path1->mpNext;
         if (path1 == aAttributePaths)
         {
-            aAttributePaths = path1->mpNext;
-            mAttributePathPool.ReleaseObject(path1);
-            path1 = aAttributePaths;
+            aAttributePaths = next;
         }
         else
         {
-            prev->mpNext = path1->mpNext;
+            prev->mpNext = next;
+        }
+        // Arena nodes stay allocated until the whole arena is released.
+        if (apArena == nullptr)
+        {
             mAttributePathPool.ReleaseObject(path1);
-            path1 = prev->mpNext;
         }
+        path1 = next;
     }
 }
 
-void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList)
+void InteractionModelEngine::ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList,
+                                                  ArenaAllocatorBase * apArena)
 {
-    ReleasePool(aEventPathList, mEventPathPool);
+    ReleasePool(aEventPathList, mEventPathPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList,
-                                                                EventPathParams & aEventPath)
+                                                                EventPathParams & aEventPath, ArenaAllocatorBase * apArena)
 {
-    CHIP_ERROR err = PushFront(aEventPathList, aEventPath, mEventPathPool);
+    CHIP_ERROR err = PushFront(aEventPathList, aEventPath, mEventPathPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "EventPath pool full");
@@ -1631,15 +1637,17 @@ CHIP_ERROR InteractionModelEngine::PushFrontEventPathParamsList(SingleLinkedList
     return err;
 }
 
-void InteractionModelEngine::ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList)
+void InteractionModelEngine::ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
+                                                          ArenaAllocatorBase * apArena)
 {
-    ReleasePool(aDataVersionFilterList, mDataVersionFilterPool);
+    ReleasePool(aDataVersionFilterList, mDataVersionFilterPool, apArena);
 }
 
 CHIP_ERROR InteractionModelEngine::PushFrontDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
-                                                                  DataVersionFilter & aDataVersionFilter)
+                                                                  DataVersionFilter & aDataVersionFilter,
+                                                                  ArenaAllocatorBase * apArena)
 {
-    CHIP_ERROR err = PushFront(aDataVersionFilterList, aDataVersionFilter, mDataVersionFilterPool);
+    CHIP_ERROR err = PushFront(aDataVersionFilterList, aDataVersionFilter, mDataVersionFilterPool, apArena);
     if (err == CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(InteractionModel, "DataVersionFilter pool full, ignore this filter");
@@ -1648,11 +1656,27 @@ CHIP_ERROR InteractionModelEngine::PushFrontDataVersionFilterList(SingleLinkedLi
     return err;
 }
 
+bool InteractionModelEngine::HasEventPaths()
+{
+    if (mEventPathPool.Allocated() != 0)
+    {
+        return true;
+    }
+
+    // Event paths allocated from the arena of a ReadHandler do not show up in the pool.
+    bool hasEventPaths = false;
+    mReadHandlers.ForEachActiveObject([&hasEventPaths](ReadHandler * handler) {
+        hasEventPaths = (handler->GetEventPathList() != nullptr);
+        return hasEventPaths ? Loop::Break : Loop::Continue;
+    });
+    return hasEventPaths;
+}
+
 template <typename T, size_t N>
 void InteractionModelEngine::ReleasePool(SingleLinkedListNode<T> *& aObjectList,
-                                         ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool)
+                                         ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool, ArenaAllocatorBase * apArena)
 {
-    SingleLinkedListNode<T> * current = aObjectList;
+    SingleLinkedListNode<T> * current = (apArena == nullptr) ? aObjectList : nullptr;
     while (current != nullptr)
     {
         SingleLinkedListNode<T> * nextObject = current->mpNext;
@@ -1665,9 +1689,9 @@ void InteractionModelEngine::ReleasePool(SingleLinkedListNode<T> *& aObjectList,
 
 template <typename T, size_t N>
 CHIP_ERROR InteractionModelEngine::PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData,
-                                             ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool)
+                                             ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool, ArenaAllocatorBase * apArena)
 {
-    SingleLinkedListNode<T> * object = aObjectPool.CreateObject();
+    SingleLinkedListNode<T> * object = (apArena != nullptr) ? apArena->New<SingleLinkedListNode<T>>() : aObjectPool.CreateObject();
     if (object == nullptr)
     {
         return CHIP_ERROR_NO_MEMORY;
@@ -56,6 +56,7 @@
 #include <app/util/attribute-metadata.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
+#include <lib/support/ArenaAllocator.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
@@ -193,23 +194,30 @@ public:
 
     reporting::ReportScheduler * GetReportScheduler() { return mReportScheduler; }
 
-    void ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList);
+    // The path list functions below take their nodes from the pools of the engine, or from apArena when it is not null.
+    // A list built with an arena must be handled with that same arena: its nodes are then never released one by one,
+    // the memory is only reclaimed when the arena itself is released.
+    void ReleaseAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
+                                  ArenaAllocatorBase * apArena = nullptr);
 
     CHIP_ERROR PushFrontAttributePathList(SingleLinkedListNode<AttributePathParams> *& aAttributePathList,
-                                          AttributePathParams & aAttributePath);
+                                          AttributePathParams & aAttributePath, ArenaAllocatorBase * apArena = nullptr);
 
     // If a concrete path indicates an attribute that is also referenced by a wildcard path in the request,
     // the path SHALL be removed from the list.
-    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
+    void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths,
+                                              ArenaAllocatorBase * apArena = nullptr);
 
-    void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
+    void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList, ArenaAllocatorBase * apArena = nullptr);
 
-    CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
+    CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath,
+                                            ArenaAllocatorBase * apArena = nullptr);
 
-    void ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList);
+    void ReleaseDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
+                                      ArenaAllocatorBase * apArena = nullptr);
 
     CHIP_ERROR PushFrontDataVersionFilterList(SingleLinkedListNode<DataVersionFilter> *& aDataVersionFilterList,
-                                              DataVersionFilter & aDataVersionFilter);
+                                              DataVersionFilter & aDataVersionFilter, ArenaAllocatorBase * apArena = nullptr);
 
     /*
      * Register an application callback to be notified of notable events when handling reads/subscribes.
@@ -607,10 +615,18 @@ private:
 
     static void ResumeSubscriptionsTimerCallback(System::Layer * apSystemLayer, void * apAppState);
 
+    /**
+     * Returns whether any ReadHandler currently has event paths, which is what decides whether there is anyone to
+     * deliver newly logged events to.
+     */
+    bool HasEventPaths();
+
     template <typename T, size_t N>
-    void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
+    void ReleasePool(SingleLinkedListNode<T> *& aObjectList, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool,
+                     ArenaAllocatorBase * apArena);
     template <typename T, size_t N>
-    CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool);
+    CHIP_ERROR PushFront(SingleLinkedListNode<T> *& aObjectList, T & aData, ObjectPool<SingleLinkedListNode<T>, N> & aObjectPool,
+                         ArenaAllocatorBase * apArena);
 
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
 
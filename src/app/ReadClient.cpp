@@ -612,6 +612,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload,
     EventReportIBs::Parser eventReportIBs;
     AttributeReportIBs::Parser attributeReportIBs;
     System::PacketBufferTLVReader reader;
+    mpCallback.OnReportPayload(aPayload);
     reader.Init(std::move(aPayload));
     err = report.Init(reader);
     SuccessOrExit(err);
@@ -112,6 +112,20 @@ public:
          */
         virtual void OnReportEnd() {}
 
+        /**
+         * Used to deliver the buffer holding a report data message, before the attribute and event reports it contains are
+         * delivered. The TLVReaders passed to OnAttributeData and OnEventData for this message read from this buffer.
+         *
+         * The buffer can be retained to keep using the reports in place rather than copying them. Once an attribute or event
+         * value has been delivered, the ReadClient only skips over its encoding, without looking at its tag.
+         *
+         * This object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy the object.
+         *
+         * @param[in] aPayload The buffer holding the report data message.
+         */
+        virtual void OnReportPayload(const System::PacketBufferHandle & aPayload) {}
+
         /**
          * Used to deliver event data received through the Read and Subscribe interactions
          *
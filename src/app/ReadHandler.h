@@ -42,6 +42,7 @@
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
+#include <lib/support/ArenaAllocator.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
@@ -306,6 +307,10 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // Reading an attribute returned CHIP_ERROR_IN_PROGRESS: the report waits, at that attribute, for
+        // Engine::ResumeSuspendedReports.
+        ReportSuspended = (1 << 6),
     };
 
     /**
@@ -383,6 +388,7 @@ private:
     // Is reporting indicates whether we are in the middle of a series chunks. As we will set mIsChunkedReport on the first chunk
     // and clear that flag on the last chunk, we can use mIsChunkedReport to indicate this state.
     bool IsReporting() const { return mFlags.Has(ReadHandlerFlags::ChunkedReport); }
+    bool IsReportSuspended() const { return mFlags.Has(ReadHandlerFlags::ReportSuspended); }
     bool IsPriming() const { return mFlags.Has(ReadHandlerFlags::PrimingReports); }
     bool IsActiveSubscription() const { return mFlags.Has(ReadHandlerFlags::ActiveSubscription); }
     bool IsFabricFiltered() const { return mFlags.Has(ReadHandlerFlags::FabricFiltered); }
@@ -430,6 +436,17 @@ private:
     size_t GetEventPathCount() const { return mpEventPathList == nullptr ? 0 : mpEventPathList->Count(); };
     size_t GetDataVersionFilterCount() const { return mpDataVersionFilterList == nullptr ? 0 : mpDataVersionFilterList->Count(); };
 
+    // Returns the arena the path lists of this handler are allocated from, or nullptr when they come from the pools of
+    // the InteractionModelEngine.
+    ArenaAllocatorBase * GetPathListArena()
+    {
+#if CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE > 0
+        return &mPathListArena;
+#else
+        return nullptr;
+#endif // CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE > 0
+    }
+
     CHIP_ERROR SendStatusReport(Protocols::InteractionModel::Status aStatus);
 
     friend class TestReadInteraction;
@@ -565,6 +582,11 @@ private:
     SingleLinkedListNode<EventPathParams> * mpEventPathList           = nullptr;
     SingleLinkedListNode<DataVersionFilter> * mpDataVersionFilterList = nullptr;
 
+#if CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE > 0
+    // Holds the nodes of the lists above; it is released in one go when the handler is destroyed.
+    ArenaAllocator<CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE> mPathListArena;
+#endif // CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE > 0
+
     ManagementCallback & mManagementCallback;
 
     uint32_t mLastWrittenEventsBytes = 0;
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the cost of encoding a single attribute into an AttributeReportIBs, as done by
+ *      AttributeAccessInterface and ember implementations for every attribute of a report.
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/benchmark/Benchmark.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+constexpr uint32_t kEncodeIterations = 100000;
+constexpr size_t kListLength         = 16;
+constexpr DataVersion kDataVersion   = 1;
+
+const ConcreteAttributePath kPath(1, 6, 0);
+const char kStringValue[] = "The quick brown fox jumps over the lazy dog";
+
+Access::SubjectDescriptor CaseSubject()
+{
+    Access::SubjectDescriptor subject;
+    subject.fabricIndex = 1;
+    subject.subject     = 1;
+    subject.authMode    = Access::AuthMode::kCase;
+    return subject;
+}
+
+/**
+ * Run @p encode against a fresh AttributeValueEncoder @p iterations times and record the result.
+ *
+ * Setting up the TLV writer and report builder is part of the measured cost, as it is for every
+ * attribute of a real report.
+ */
+template <typename EncodeFunction>
+void RunEncode(const char * name, EncodeFunction && encode)
+{
+    const Access::SubjectDescriptor subject = CaseSubject();
+    uint8_t buffer[1024];
+    size_t encodedLength = 0;
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t i = 0; i < kEncodeIterations; i++)
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+
+        AttributeReportIBs::Builder builder;
+        TLV::TLVType outerType;
+        ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType), CHIP_NO_ERROR);
+        ASSERT_EQ(builder.Init(&writer, 1), CHIP_NO_ERROR);
+
+        AttributeValueEncoder encoder(builder, subject, kPath, kDataVersion);
+        ASSERT_EQ(encode(encoder), CHIP_NO_ERROR);
+        encodedLength = writer.GetLengthWritten();
+    }
+    Benchmark::RecordResult(name, kEncodeIterations, stopwatch, kEncodeIterations)
+        .AddCounter("bytes", static_cast<double>(encodedLength));
+}
+
+TEST(EncodeBenchmarks, EncodeUnsigned)
+{
+    RunEncode("EncodeAttribute/uint32",
+              [](AttributeValueEncoder & encoder) { return encoder.Encode(static_cast<uint32_t>(0x12345678)); });
+}
+
+TEST(EncodeBenchmarks, EncodeString)
+{
+    RunEncode("EncodeAttribute/string", [](AttributeValueEncoder & encoder) {
+        return encoder.Encode(CharSpan::fromCharString(kStringValue));
+    });
+}
+
+TEST(EncodeBenchmarks, EncodeList)
+{
+    RunEncode("EncodeAttribute/list:16", [](AttributeValueEncoder & encoder) {
+        return encoder.EncodeList([](const auto & listEncoder) -> CHIP_ERROR {
+            for (uint32_t item = 0; item < kListLength; item++)
+            {
+                ReturnErrorOnFailure(listEncoder.Encode(item));
+            }
+            return CHIP_NO_ERROR;
+        });
+    });
+}
+
+} // namespace
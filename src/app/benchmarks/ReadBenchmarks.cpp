@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the Interaction Model read and report path: InteractionModelEngine, ReadHandler and
+ *      reporting::Engine serving ReadClients over the loopback transport, with the mock ember data model.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/tests/AppTestContext.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/benchmark/Benchmark.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <stdio.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+// Upper bound on the time a single benchmark iteration may take before it is considered stuck.
+constexpr System::Clock::Timeout kIterationTimeout = System::Clock::Seconds16(5);
+
+constexpr uint32_t kWildcardReadIterations    = 200;
+constexpr uint32_t kConcreteReadIterations    = 1000;
+constexpr uint32_t kReportIterations          = 200;
+constexpr size_t kSubscriptionCounts[]        = { 1, 4, 16 };
+constexpr uint16_t kMaxIntervalCeilingSeconds = 3600;
+
+class CountingCallback : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mAttributeCount++;
+    }
+    void OnReportEnd() override { mReportCount++; }
+    void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override { mSubscriptionCount++; }
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+    void OnDone(ReadClient *) override { mDoneCount++; }
+
+    uint64_t mAttributeCount    = 0;
+    uint64_t mReportCount       = 0;
+    uint32_t mSubscriptionCount = 0;
+    uint32_t mDoneCount         = 0;
+    CHIP_ERROR mError           = CHIP_NO_ERROR;
+};
+
+class ReadBenchmarks : public chip::Test::AppContext
+{
+public:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&TestImCustomDataModel::Instance());
+    }
+
+    void TearDown() override
+    {
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        AppContext::TearDown();
+    }
+
+protected:
+    // DrainAndServiceIO() always ends with an idle wait, which would dominate the measurements. Instead, drive
+    // the event loop only until the expected work is done: every step of the read and report exchanges is
+    // triggered by a message or a zero-delay timer, so no iteration ever has to wait for the loop to go idle.
+    template <typename Predicate>
+    void ServiceUntil(Predicate && done)
+    {
+        GetIOContext().DriveIOUntil(kIterationTimeout, std::forward<Predicate>(done));
+    }
+
+    void RunRead(const char * name, AttributePathParams & path, uint32_t iterations);
+    void RunReportThroughput(size_t subscriptionCount);
+
+private:
+    DataModel::Provider * mOldProvider = nullptr;
+};
+
+void ReadBenchmarks::RunRead(const char * name, AttributePathParams & path, uint32_t iterations)
+{
+    CountingCallback callback;
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = &path;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    auto readOnce = [&]() {
+        ReadClient readClient(InteractionModelEngine::GetInstance(), &GetExchangeManager(), callback,
+                              ReadClient::InteractionType::Read);
+        uint32_t expectedDone = callback.mDoneCount + 1;
+        EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        ServiceUntil([&]() { return callback.mDoneCount == expectedDone; });
+    };
+
+    // Warm up pools and caches outside of the measured loop.
+    readOnce();
+    callback.mAttributeCount = 0;
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        readOnce();
+    }
+    Benchmark::RecordResult(name, iterations, stopwatch, callback.mAttributeCount);
+
+    EXPECT_EQ(callback.mDoneCount, iterations + 1);
+    EXPECT_GT(callback.mAttributeCount, 0u);
+    EXPECT_EQ(callback.mError, CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 0u);
+}
+
+void ReadBenchmarks::RunReportThroughput(size_t subscriptionCount)
+{
+    auto * engine = InteractionModelEngine::GetInstance();
+
+    CountingCallback callback;
+    AttributePathParams path(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3), chip::Test::MockAttributeId(1));
+    std::vector<std::unique_ptr<ReadClient>> readClients;
+
+    for (size_t i = 0; i < subscriptionCount; i++)
+    {
+        ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+        readPrepareParams.mpAttributePathParamsList    = &path;
+        readPrepareParams.mAttributePathParamsListSize = 1;
+        readPrepareParams.mMinIntervalFloorSeconds     = 0;
+        readPrepareParams.mMaxIntervalCeilingSeconds   = kMaxIntervalCeilingSeconds;
+
+        readClients.emplace_back(
+            std::make_unique<ReadClient>(engine, &GetExchangeManager(), callback, ReadClient::InteractionType::Subscribe));
+        EXPECT_EQ(readClients.back()->SendRequest(readPrepareParams), CHIP_NO_ERROR);
+    }
+    ServiceUntil([&]() { return callback.mSubscriptionCount == subscriptionCount; });
+    ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), subscriptionCount);
+
+    callback.mReportCount = 0;
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t i = 0; i < kReportIterations; i++)
+    {
+        uint64_t expectedReports = callback.mReportCount + subscriptionCount;
+        EXPECT_EQ(engine->GetReportingEngine().SetDirty(path), CHIP_NO_ERROR);
+        ServiceUntil([&]() { return callback.mReportCount >= expectedReports; });
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "ReportThroughput/subscriptions:%u", static_cast<unsigned>(subscriptionCount));
+    Benchmark::RecordResult(name, kReportIterations, stopwatch, callback.mReportCount);
+
+    EXPECT_EQ(callback.mReportCount, kReportIterations * subscriptionCount);
+    EXPECT_EQ(callback.mError, CHIP_NO_ERROR);
+
+    readClients.clear();
+    engine->ShutdownAllSubscriptions();
+    DrainAndServiceIO();
+}
+
+TEST_F(ReadBenchmarks, WildcardRead)
+{
+    // Reads every attribute of every endpoint in the mock data model, including a list attribute that
+    // does not fit in a single message and is therefore chunked.
+    AttributePathParams path;
+    RunRead("WildcardRead", path, kWildcardReadIterations);
+}
+
+TEST_F(ReadBenchmarks, ConcreteRead)
+{
+    AttributePathParams path(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3), chip::Test::MockAttributeId(1));
+    RunRead("ConcreteRead", path, kConcreteReadIterations);
+}
+
+TEST_F(ReadBenchmarks, ReportThroughput)
+{
+    for (size_t subscriptionCount : kSubscriptionCounts)
+    {
+        RunReportThroughput(subscriptionCount);
+    }
+}
+
+} // namespace
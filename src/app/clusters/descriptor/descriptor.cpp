@@ -93,18 +93,22 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    // The endpoint index is used as the list cursor, so that when the list is chunked, e.g. on a bridge with many
+    // endpoints, each chunk resumes at the endpoint following the last one encoded, instead of walking again over all
+    // the endpoints encoded in previous chunks.
     if (endpoint == 0x00)
     {
         err = aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+            for (uint32_t cursor = encoder.ResumeListCursor(); cursor < emberAfEndpointCount(); cursor++)
             {
+                const auto index = static_cast<uint16_t>(cursor);
                 if (emberAfEndpointIndexIsEnabled(index))
                 {
                     EndpointId endpointId = emberAfEndpointFromIndex(index);
                     if (endpointId == 0)
                         continue;
 
-                    ReturnErrorOnFailure(encoder.Encode(endpointId));
+                    ReturnErrorOnFailure(encoder.EncodeWithCursor(endpointId, cursor + 1));
                 }
             }
 
@@ -114,8 +118,9 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
     else if (IsFlatCompositionForEndpoint(endpoint))
     {
         err = aEncoder.EncodeList([endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+            for (uint32_t cursor = encoder.ResumeListCursor(); cursor < emberAfEndpointCount(); cursor++)
             {
+                const auto index = static_cast<uint16_t>(cursor);
                 if (!emberAfEndpointIndexIsEnabled(index))
                     continue;
 
@@ -128,7 +133,7 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 
                     if (parentEndpointId == endpoint)
                     {
-                        ReturnErrorOnFailure(encoder.Encode(emberAfEndpointFromIndex(index)));
+                        ReturnErrorOnFailure(encoder.EncodeWithCursor(emberAfEndpointFromIndex(index), cursor + 1));
                         break;
                     }
 
@@ -142,15 +147,16 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
     else if (IsTreeCompositionForEndpoint(endpoint))
     {
         err = aEncoder.EncodeList([endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+            for (uint32_t cursor = encoder.ResumeListCursor(); cursor < emberAfEndpointCount(); cursor++)
             {
+                const auto index = static_cast<uint16_t>(cursor);
                 if (!emberAfEndpointIndexIsEnabled(index))
                     continue;
 
                 EndpointId parentEndpointId = emberAfParentEndpointFromIndex(index);
                 if (parentEndpointId == endpoint)
                 {
-                    ReturnErrorOnFailure(encoder.Encode(emberAfEndpointFromIndex(index)));
+                    ReturnErrorOnFailure(encoder.EncodeWithCursor(emberAfEndpointFromIndex(index), cursor + 1));
                 }
             }
 
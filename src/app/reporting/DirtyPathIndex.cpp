@@ -0,0 +1,224 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathIndex.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+unsigned DirtyPathIndex::ShapeOf(const AttributePathParams & aPath)
+{
+    return (aPath.HasWildcardEndpointId() ? kWildcardEndpoint : 0u) | (aPath.HasWildcardClusterId() ? kWildcardCluster : 0u) |
+        (aPath.HasWildcardAttributeId() ? kWildcardAttribute : 0u);
+}
+
+AttributePathParams DirtyPathIndex::WithShape(const AttributePathParams & aPath, unsigned aShape)
+{
+    return AttributePathParams((aShape & kWildcardEndpoint) ? kInvalidEndpointId : aPath.mEndpointId,
+                               (aShape & kWildcardCluster) ? kInvalidClusterId : aPath.mClusterId,
+                               (aShape & kWildcardAttribute) ? kInvalidAttributeId : aPath.mAttributeId);
+}
+
+uint32_t DirtyPathIndex::HashOf(const AttributePathParams & aPath)
+{
+    return HashIndexFold((static_cast<uint64_t>(aPath.mClusterId) << 32) | aPath.mAttributeId) ^
+        (static_cast<uint32_t>(aPath.mEndpointId) << 16);
+}
+
+bool DirtyPathIndex::SameKey(const AttributePathParams & aLhs, const AttributePathParams & aRhs)
+{
+    return aLhs.mEndpointId == aRhs.mEndpointId && aLhs.mClusterId == aRhs.mClusterId && aLhs.mAttributeId == aRhs.mAttributeId;
+}
+
+DirtyPathIndex::DirtyPath * DirtyPathIndex::Find(const AttributePathParams & aKey) const
+{
+    return mIndex.Find(HashOf(aKey), [&](const DirtyPath * path) { return SameKey(*path, aKey); });
+}
+
+DirtyPathIndex::DirtyPath * DirtyPathIndex::FindCovering(const AttributePathParams & aPath) const
+{
+    const unsigned pathShape = ShapeOf(aPath);
+    for (unsigned shape = pathShape; shape < kAllWildcards; shape++)
+    {
+        if ((shape & pathShape) != pathShape || mShapeCounts[shape] == 0)
+        {
+            continue;
+        }
+        DirtyPath * path = Find(WithShape(aPath, shape));
+        if (path != nullptr)
+        {
+            return path;
+        }
+    }
+    return nullptr;
+}
+
+uint64_t DirtyPathIndex::GetDirtyGeneration(const ConcreteAttributePath & aPath) const
+{
+    const AttributePathParams key(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+    uint64_t generation = mAllPathsGeneration;
+
+    // Unlike FindCovering(), every covering path is needed here, as they may have been marked dirty at different generations.
+    for (unsigned shape = 0; shape < kAllWildcards; shape++)
+    {
+        if (mShapeCounts[shape] == 0)
+        {
+            continue;
+        }
+        const DirtyPath * path = Find(WithShape(key, shape));
+        if (path != nullptr)
+        {
+            generation = std::max(generation, path->mGeneration);
+        }
+    }
+    return generation;
+}
+
+bool DirtyPathIndex::Add(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    DirtyPath * path = mPaths.CreateObject(aPath);
+    VerifyOrReturnValue(path != nullptr, false);
+
+    if (mIndex.Insert(HashOf(*path), path) != CHIP_NO_ERROR)
+    {
+        mPaths.ReleaseObject(path);
+        return false;
+    }
+    path->mGeneration = aGeneration;
+    mShapeCounts[ShapeOf(*path)]++;
+    return true;
+}
+
+void DirtyPathIndex::Remove(DirtyPath * aPath)
+{
+    mIndex.Remove(HashOf(*aPath), aPath);
+    mShapeCounts[ShapeOf(*aPath)]--;
+}
+
+void DirtyPathIndex::Widen(DirtyPath * aPath, unsigned aShape)
+{
+    Remove(aPath);
+    *static_cast<AttributePathParams *>(aPath) = WithShape(*aPath, aShape);
+    // The index already held this path, so inserting it again cannot fail.
+    VerifyOrDie(mIndex.Insert(HashOf(*aPath), aPath) == CHIP_NO_ERROR);
+    mShapeCounts[aShape]++;
+}
+
+bool DirtyPathIndex::Merge(unsigned aMergeShape)
+{
+    const bool byCluster = (aMergeShape == kWildcardAttribute);
+
+    mPaths.ForEachActiveObject([&](DirtyPath * outerPath) {
+        if (outerPath->mGeneration == 0 || (byCluster ? outerPath->HasWildcardClusterId() : outerPath->HasWildcardEndpointId()))
+        {
+            return Loop::Continue;
+        }
+        bool merged = false;
+        mPaths.ForEachActiveObject([&](DirtyPath * innerPath) {
+            if (innerPath == outerPath || innerPath->mGeneration == 0 || innerPath->mEndpointId != outerPath->mEndpointId ||
+                (byCluster && innerPath->mClusterId != outerPath->mClusterId))
+            {
+                return Loop::Continue;
+            }
+            outerPath->mGeneration = std::max(outerPath->mGeneration, innerPath->mGeneration);
+
+            // The object pool does not allow us to release objects in a nested iteration, so the path is only removed from
+            // the index here, and marked as a tomb by setting its generation to 0 to be released after the iteration.
+            Remove(innerPath);
+            innerPath->mGeneration = 0;
+            merged                 = true;
+            return Loop::Continue;
+        });
+        if (merged)
+        {
+            Widen(outerPath, ShapeOf(*outerPath) | aMergeShape);
+        }
+        return Loop::Continue;
+    });
+
+    bool pathReleased = false;
+    mPaths.ForEachActiveObject([&](DirtyPath * path) {
+        if (path->mGeneration == 0)
+        {
+            mPaths.ReleaseObject(path);
+            pathReleased = true;
+        }
+        return Loop::Continue;
+    });
+    return pathReleased;
+}
+
+void DirtyPathIndex::Insert(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    if (ShapeOf(aPath) == kAllWildcards)
+    {
+        Clear();
+        mAllPathsGeneration = aGeneration;
+        return;
+    }
+
+    DirtyPath * path = Find(aPath);
+    if (path != nullptr)
+    {
+        path->mGeneration = aGeneration;
+        return;
+    }
+    if (Add(aPath, aGeneration))
+    {
+        return;
+    }
+
+    // Merging only helps when the bounded pool is full; a failed heap allocation goes straight to the all-wildcard path,
+    // which also gives the memory back.
+    if (mPaths.Exhausted() && (Merge(kWildcardAttribute) || Merge(kWildcardCluster | kWildcardAttribute)))
+    {
+        // One of the merged paths may now cover the new path, otherwise there is room for it.
+        path = FindCovering(aPath);
+        if (path != nullptr)
+        {
+            path->mGeneration = aGeneration;
+            return;
+        }
+        if (Add(aPath, aGeneration))
+        {
+            return;
+        }
+    }
+
+    ChipLogDetail(DataManagement, "Dirty path set full, merge all paths.");
+    Clear();
+    mAllPathsGeneration = aGeneration;
+}
+
+void DirtyPathIndex::Clear()
+{
+    mIndex.Clear();
+    mPaths.ReleaseAll();
+    std::fill(std::begin(mShapeCounts), std::end(mShapeCounts), 0);
+    mAllPathsGeneration = 0;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
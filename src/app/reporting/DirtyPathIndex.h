@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AppConfig.h>
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/HashIndex.h>
+#include <lib/support/Pool.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class DirtyPathIndex
+ *
+ * @brief The set of attribute paths marked dirty by the reporting engine, each tagged with the dirty set generation at
+ *        which it was last marked dirty.
+ *
+ * Paths are stored as given, with any combination of wildcard endpoint, cluster and attribute ids, and are indexed
+ * by (endpoint, cluster, attribute). Finding the latest generation at which a concrete attribute path was marked dirty
+ * only requires looking up the few wildcard patterns that can cover it, e.g. (endpoint, cluster, attribute),
+ * (endpoint, cluster, *) and (endpoint, *, *), so its cost does not depend on the number of dirty paths. List indices
+ * are not tracked: a dirty list entry marks the whole attribute dirty.
+ *
+ * When no more paths can be stored, existing paths are merged into wildcard paths for their cluster, then for their
+ * endpoint, and as a last resort the whole set collapses into the all-wildcard path. Merging never loses a dirty path,
+ * it only makes more paths appear dirty.
+ */
+class DirtyPathIndex
+{
+public:
+    struct DirtyPath : public AttributePathParams
+    {
+        DirtyPath() {}
+        DirtyPath(const AttributePathParams & aPath) : AttributePathParams(aPath) { mListIndex = kInvalidListIndex; }
+        uint64_t mGeneration = 0;
+    };
+
+    DirtyPathIndex() = default;
+    ~DirtyPathIndex() { Clear(); }
+
+    DirtyPathIndex(const DirtyPathIndex &)             = delete;
+    DirtyPathIndex & operator=(const DirtyPathIndex &) = delete;
+
+    /**
+     * Preallocate the index for CHIP_IM_SERVER_MAX_NUM_DIRTY_SET paths, so that no allocation is needed while the set
+     * stays within that size. This never allocates when the paths are statically allocated.
+     */
+    CHIP_ERROR Init() { return mIndex.Reserve(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET); }
+
+    /**
+     * Mark a path as dirty at the given generation.
+     *
+     * aGeneration must not be lower than any generation previously inserted since the last Clear().
+     */
+    void Insert(const AttributePathParams & aPath, uint64_t aGeneration);
+
+    /**
+     * Returns the latest generation at which a path covering aPath was marked dirty, or 0 if no such path exists.
+     */
+    uint64_t GetDirtyGeneration(const ConcreteAttributePath & aPath) const;
+
+    /**
+     * Remove all the paths.
+     */
+    void Clear();
+
+    /**
+     * Returns the number of paths in the set, counting the all-wildcard path if it is present.
+     */
+    size_t Size() const { return mPaths.Allocated() + (mAllPathsGeneration != 0 ? 1 : 0); }
+
+    /**
+     * Call function with a DirtyPath * for each path in the set, in no particular order.
+     *
+     * The set must not be modified by the function.
+     */
+    template <typename Function>
+    Loop ForEachPath(Function && function)
+    {
+        if (mAllPathsGeneration != 0)
+        {
+            DirtyPath allPaths;
+            allPaths.mGeneration = mAllPathsGeneration;
+            VerifyOrReturnValue(function(&allPaths) == Loop::Continue, Loop::Break);
+        }
+        return mPaths.ForEachActiveObject([&](DirtyPath * path) { return function(path); });
+    }
+
+private:
+    // A path shape is the combination of its wildcard ids, used both as a bit mask and as an index in mShapeCounts.
+    static constexpr unsigned kWildcardAttribute = 0x1;
+    static constexpr unsigned kWildcardCluster   = 0x2;
+    static constexpr unsigned kWildcardEndpoint  = 0x4;
+    static constexpr unsigned kShapeCount        = 8;
+    static constexpr unsigned kAllWildcards      = kShapeCount - 1;
+
+    static unsigned ShapeOf(const AttributePathParams & aPath);
+    static AttributePathParams WithShape(const AttributePathParams & aPath, unsigned aShape);
+    static uint32_t HashOf(const AttributePathParams & aPath);
+    static bool SameKey(const AttributePathParams & aLhs, const AttributePathParams & aRhs);
+
+    DirtyPath * Find(const AttributePathParams & aKey) const;
+
+    /**
+     * Returns a path of the set that is a superset of aPath, if any.
+     */
+    DirtyPath * FindCovering(const AttributePathParams & aPath) const;
+
+    bool Add(const AttributePathParams & aPath, uint64_t aGeneration);
+    void Remove(DirtyPath * aPath);
+
+    /**
+     * Changes the wildcards of a path in the set, keeping the index consistent.
+     */
+    void Widen(DirtyPath * aPath, unsigned aShape);
+
+    /**
+     * Merge the paths sharing an endpoint and cluster into a wildcard path for that cluster (aMergeShape is
+     * kWildcardAttribute), or the paths sharing an endpoint into a wildcard path for that endpoint (aMergeShape is
+     * kWildcardCluster | kWildcardAttribute).
+     *
+     * Returns whether any path was released.
+     */
+    bool Merge(unsigned aMergeShape);
+
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // For unit tests, always use inline allocation for code coverage.
+    ObjectPool<DirtyPath, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mPaths;
+#else
+    ObjectPool<DirtyPath, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mPaths;
+#endif
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST || !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // mPaths never holds more than CHIP_IM_SERVER_MAX_NUM_DIRTY_SET paths, so the index uses fixed storage as well.
+    HashIndex<DirtyPath, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mIndex;
+#else
+    HashIndex<DirtyPath> mIndex;
+#endif
+    size_t mShapeCounts[kShapeCount] = {};
+
+    // The all-wildcard path is kept out of mPaths, so that collapsing the set never requires an allocation.
+    uint64_t mAllPathsGeneration = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,168 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implements the storage for the event log in a memory-mapped file.
+ *
+ *      The file starts with a FileHeader, followed by the event buffers, each aligned on kBufferAlignment bytes. The
+ *      header is in host byte order, as the file is only meant to be read back by the device that wrote it.
+ */
+
+#include <app/server/MappedEventLogStorage.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr uint32_t kFileMagic     = 0x4c564543; // "CEVL"
+constexpr uint32_t kFileVersion   = 1;
+constexpr size_t kBufferAlignment = 8;
+constexpr size_t kBufferCount     = MappedEventLogStorage::kBufferCount;
+
+struct BufferHeader
+{
+    uint32_t mSize;
+    uint32_t mPriority;
+    CircularEventBufferState mState;
+};
+
+struct FileHeader
+{
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint32_t mBufferCount;
+    uint32_t mReserved;
+    BufferHeader mBuffers[kBufferCount];
+};
+
+constexpr size_t AlignUp(size_t size)
+{
+    return (size + kBufferAlignment - 1) / kBufferAlignment * kBufferAlignment;
+}
+
+bool HeaderMatches(const FileHeader & header, const uint32_t (&bufferSizes)[kBufferCount])
+{
+    VerifyOrReturnValue(header.mMagic == kFileMagic && header.mVersion == kFileVersion && header.mBufferCount == kBufferCount,
+                        false);
+    for (size_t i = 0; i < kBufferCount; i++)
+    {
+        VerifyOrReturnValue(header.mBuffers[i].mSize == bufferSizes[i], false);
+        VerifyOrReturnValue(header.mBuffers[i].mPriority == to_underlying(PriorityLevel::First) + i, false);
+    }
+    return true;
+}
+
+} // namespace
+
+CHIP_ERROR MappedEventLogStorage::Open(const char * path, const uint32_t (&bufferSizes)[kBufferCount])
+{
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t fileSize = AlignUp(sizeof(FileHeader));
+    for (uint32_t bufferSize : bufferSizes)
+    {
+        VerifyOrReturnError(bufferSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+        fileSize += AlignUp(bufferSize);
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        ChipLogError(EventLogging, "Failed to open event log file (%s), %s (%d)", path, strerror(errno), errno);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || (static_cast<size_t>(fileStat.st_size) != fileSize &&
+                                      ftruncate(fd, static_cast<off_t>(fileSize)) != 0))
+    {
+        ChipLogError(EventLogging, "Failed to size event log file (%s), %s (%d)", path, strerror(errno), errno);
+        close(fd);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    // The mapping stays valid once the file is closed.
+    void * mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        ChipLogError(EventLogging, "Failed to map event log file (%s), %s (%d)", path, strerror(errno), errno);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    auto * header = static_cast<FileHeader *>(mapping);
+    if (!HeaderMatches(*header, bufferSizes))
+    {
+        if (header->mMagic != 0)
+        {
+            ChipLogProgress(EventLogging, "Event log file (%s) has a different layout, dropping its events", path);
+        }
+        memset(header, 0, sizeof(*header));
+        for (size_t i = 0; i < kBufferCount; i++)
+        {
+            header->mBuffers[i].mSize     = bufferSizes[i];
+            header->mBuffers[i].mPriority = static_cast<uint32_t>(to_underlying(PriorityLevel::First) + i);
+        }
+        header->mBufferCount = kBufferCount;
+        header->mVersion     = kFileVersion;
+        header->mMagic       = kFileMagic;
+    }
+
+    uint8_t * buffer = static_cast<uint8_t *>(mapping) + AlignUp(sizeof(FileHeader));
+    for (size_t i = 0; i < kBufferCount; i++)
+    {
+        mResources[i].mpBuffer    = buffer;
+        mResources[i].mBufferSize = bufferSizes[i];
+        mResources[i].mPriority   = static_cast<PriorityLevel>(to_underlying(PriorityLevel::First) + i);
+        mResources[i].mpState     = &header->mBuffers[i].mState;
+        buffer += AlignUp(bufferSizes[i]);
+    }
+
+    mMapping     = mapping;
+    mMappingSize = fileSize;
+    return CHIP_NO_ERROR;
+}
+
+void MappedEventLogStorage::Close()
+{
+    VerifyOrReturn(IsOpen());
+
+    munmap(mMapping, mMappingSize);
+    mMapping     = nullptr;
+    mMappingSize = 0;
+    for (auto & resources : mResources)
+    {
+        resources = LogStorageResources();
+    }
+}
+
+} // namespace app
+} // namespace chip
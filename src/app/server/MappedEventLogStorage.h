@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Storage for the event log in a memory-mapped file, for POSIX platforms.
+ *
+ *      The event buffers are mapped from the file, so the events survive a restart or a crash of the process without being
+ *      serialized: writes to the buffers only dirty the page cache, which the kernel writes back to the file. Events logged
+ *      shortly before a power loss may be lost.
+ */
+
+#pragma once
+
+#include <app/EventManagement.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/TypeTraits.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+class MappedEventLogStorage
+{
+public:
+    /// Number of event buffers, one for each priority level from Debug to Critical.
+    static constexpr size_t kBufferCount = to_underlying(PriorityLevel::Last) - to_underlying(PriorityLevel::First) + 1;
+
+    MappedEventLogStorage() = default;
+    ~MappedEventLogStorage() { Close(); }
+
+    MappedEventLogStorage(const MappedEventLogStorage &)             = delete;
+    MappedEventLogStorage & operator=(const MappedEventLogStorage &) = delete;
+
+    /**
+     * Open the file at the given path, creating it if needed, and map the event buffers from it.
+     *
+     * If the file holds event buffers of the same sizes, e.g. from a previous run, their events are kept. Otherwise the
+     * file is resized and starts with empty buffers.
+     *
+     * @param[in] path         Path of the file.
+     * @param[in] bufferSizes  Size, in bytes, of the buffer of each priority level, from Debug to Critical.
+     */
+    CHIP_ERROR Open(const char * path, const uint32_t (&bufferSizes)[kBufferCount]);
+
+    /// Unmap the file. The storage must not be in use by EventManagement anymore.
+    void Close();
+
+    bool IsOpen() const { return mMapping != nullptr; }
+
+    /**
+     * The resources to give to EventManagement::Init, or to the server through ServerInitParams, as an array of
+     * kBufferCount elements from Debug to Critical. Valid while the storage is open.
+     */
+    const LogStorageResources * GetLogStorageResources() const { return IsOpen() ? mResources : nullptr; }
+
+private:
+    void * mMapping     = nullptr;
+    size_t mMappingSize = 0;
+    LogStorageResources mResources[kBufferCount];
+};
+
+} // namespace app
+} // namespace chip
@@ -25,6 +25,7 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DefaultAttributePersistenceProvider.h>
+#include <app/EventManagement.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
@@ -179,6 +180,10 @@ struct ServerInitParams
     // Optional. Support for the ICD Check-In BackOff strategy. Must be initialized before being provided.
     // If the ICD Check-In protocol use-case is supported and no strategy is provided, server will use the default strategy.
     app::ICDCheckInBackOffStrategy * icdCheckInBackOffStrategy = nullptr;
+    // Optional. Storage for the event log, as one LogStorageResources for each of the Debug, Info and Critical
+    // priorities, in that order. Must be kept alive until the server is shut down. If not provided, events are
+    // logged into static buffers and are lost when the process exits.
+    const app::LogStorageResources * eventLogStorageResources = nullptr;
 };
 
 /**
@@ -577,6 +577,81 @@ TEST(TestAttributeValueEncoder, TestEncodeListChunking2)
     }
 }
 
+TEST(TestAttributeValueEncoder, TestEncodeListChunkingWithCursor)
+{
+    bool list[] = { true, false, false, true, true, false };
+
+    // Encode the list in the same chunks as TestEncodeListChunking, with a list generator that resumes each chunk from
+    // the list cursor. The output must be the same, while the generator does not walk over the items already encoded.
+    uint32_t resumedFrom[3] = {};
+    size_t visitedItems     = 0;
+    size_t chunk            = 0;
+    auto listEncoder        = [&](const auto & encoder) -> CHIP_ERROR {
+        resumedFrom[chunk] = encoder.ResumeListCursor();
+        for (uint32_t index = resumedFrom[chunk]; index < ArraySize(list); index++)
+        {
+            visitedItems++;
+            ReturnErrorOnFailure(encoder.EncodeWithCursor(list[index], index + 1));
+        }
+        return CHIP_NO_ERROR;
+    };
+    auto plainListEncoder = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    AttributeEncodeState state;
+    AttributeEncodeState plainState;
+    {
+        LimitedTestSetup<30> test1(kTestFabricIndex);
+        LimitedTestSetup<30> plainTest1(kTestFabricIndex);
+        CHIP_ERROR err = test1.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(plainTest1.encoder.EncodeList(plainListEncoder), err);
+        state      = test1.encoder.GetState();
+        plainState = plainTest1.encoder.GetState();
+
+        EXPECT_EQ(state.ListCursor(), 2u);
+        EXPECT_EQ(state.CurrentEncodingListIndex(), plainState.CurrentEncodingListIndex());
+        ASSERT_EQ(test1.writer.GetLengthWritten(), plainTest1.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test1.buf, plainTest1.buf, test1.writer.GetLengthWritten()), 0);
+    }
+    {
+        chunk++;
+        LimitedTestSetup<30> test2(0, state);
+        LimitedTestSetup<30> plainTest2(0, plainState);
+        CHIP_ERROR err = test2.encoder.EncodeList(listEncoder);
+        EXPECT_TRUE(err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        EXPECT_EQ(plainTest2.encoder.EncodeList(plainListEncoder), err);
+        state      = test2.encoder.GetState();
+        plainState = plainTest2.encoder.GetState();
+
+        EXPECT_EQ(state.ListCursor(), 3u);
+        EXPECT_EQ(state.CurrentEncodingListIndex(), plainState.CurrentEncodingListIndex());
+        ASSERT_EQ(test2.writer.GetLengthWritten(), plainTest2.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test2.buf, plainTest2.buf, test2.writer.GetLengthWritten()), 0);
+    }
+    {
+        chunk++;
+        TestSetup test3(0, state);
+        TestSetup plainTest3(0, plainState);
+        EXPECT_EQ(test3.encoder.EncodeList(listEncoder), CHIP_NO_ERROR);
+        EXPECT_EQ(plainTest3.encoder.EncodeList(plainListEncoder), CHIP_NO_ERROR);
+
+        ASSERT_EQ(test3.writer.GetLengthWritten(), plainTest3.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(test3.buf, plainTest3.buf, test3.writer.GetLengthWritten()), 0);
+    }
+
+    EXPECT_EQ(resumedFrom[0], 0u);
+    EXPECT_EQ(resumedFrom[1], 2u);
+    EXPECT_EQ(resumedFrom[2], 3u);
+    // Each chunk visits the items it encodes, plus the one that did not fit.
+    EXPECT_EQ(visitedItems, ArraySize(list) + 2);
+}
+
 TEST(TestAttributeValueEncoder, TestEncodePreEncoded)
 {
     TestSetup test{};
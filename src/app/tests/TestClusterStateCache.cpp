@@ -28,6 +28,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/ClusterStateCache.h>
+#include <app/MessageDef/AttributeDataIB.h>
 #include <app/MessageDef/DataVersionFilterIBs.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
@@ -771,4 +772,192 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+class NullCacheCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+void WriteOctetStringReport(ReadClient::Callback & callback, EndpointId endpointId, uint8_t fill, size_t length)
+{
+    ConcreteDataAttributePath path(endpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::OctetString::Id);
+    path.mDataVersion.SetValue(1);
+
+    std::vector<uint8_t> value(length, fill);
+    Platform::ScopedMemoryBufferWithSize<uint8_t> handle;
+    ASSERT_TRUE(handle.Calloc(length + 16));
+    TLV::ScopedBufferTLVWriter writer(std::move(handle), length + 16);
+    EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), ByteSpan(value.data(), value.size())), CHIP_NO_ERROR);
+
+    uint32_t writtenLength = writer.GetLengthWritten();
+    writer.Finalize(handle);
+    TLV::ScopedBufferTLVReader reader;
+    reader.Init(std::move(handle), writtenLength);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    callback.OnAttributeData(path, &reader, StatusIB());
+}
+
+void ValidateOctetString(const ClusterStateCache & cache, EndpointId endpointId, uint8_t fill, size_t length)
+{
+    ConcreteAttributePath path(endpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::OctetString::Id);
+    Clusters::UnitTesting::Attributes::OctetString::TypeInfo::DecodableType value;
+    ASSERT_EQ(cache.Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, value), CHIP_NO_ERROR);
+    ASSERT_EQ(value.size(), length);
+    for (auto byte : value)
+    {
+        EXPECT_EQ(byte, fill);
+    }
+}
+
+/*
+ * Repeatedly overwrites cached values of various sizes, including some larger than the cache storage blocks, so that the
+ * storage gets compacted between reports, and validates that the cached values stay intact.
+ */
+TEST_F(TestClusterStateCache, TestRepeatedReports)
+{
+    constexpr EndpointId kEndpointCount = 4;
+    constexpr uint8_t kReportCount      = 16;
+
+    NullCacheCallback callback;
+    ClusterStateCache cache(callback);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+
+    auto lengthOf = [](EndpointId endpointId, uint8_t report) -> size_t {
+        return (endpointId == 0) ? CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE + report : 100u * (endpointId + report % 3);
+    };
+
+    for (uint8_t report = 0; report < kReportCount; report++)
+    {
+        readCallback.OnReportBegin();
+        for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+        {
+            WriteOctetStringReport(readCallback, endpointId, static_cast<uint8_t>(report + endpointId),
+                                   lengthOf(endpointId, report));
+        }
+        readCallback.OnReportEnd();
+
+        for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+        {
+            ValidateOctetString(cache, endpointId, static_cast<uint8_t>(report + endpointId), lengthOf(endpointId, report));
+        }
+    }
+
+    // Clearing an endpoint leaves the clusters of the other endpoints in place.
+    cache.ClearAttributes(EndpointId(1));
+
+    ConcreteAttributePath clearedPath(1, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::OctetString::Id);
+    TLV::TLVReader reader;
+    EXPECT_EQ(cache.Get(clearedPath, reader), CHIP_ERROR_KEY_NOT_FOUND);
+
+    constexpr uint8_t kLastReport = kReportCount - 1;
+    for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+    {
+        if (endpointId != 1)
+        {
+            ValidateOctetString(cache, endpointId, static_cast<uint8_t>(kLastReport + endpointId),
+                                lengthOf(endpointId, kLastReport));
+        }
+    }
+
+    // A report following the clear reuses the released storage.
+    readCallback.OnReportBegin();
+    WriteOctetStringReport(readCallback, 1, 0xAA, 10);
+    readCallback.OnReportEnd();
+    ValidateOctetString(cache, 1, 0xAA, 10);
+    ValidateOctetString(cache, 2, static_cast<uint8_t>(kLastReport + 2), lengthOf(2, kLastReport));
+}
+
+/*
+ * Feeds the cache with values read from a report buffer, as the ReadClient does, with bulk ingestion enabled, and
+ * validates that the values are read in place from the buffer once the report is over.
+ */
+TEST_F(TestClusterStateCache, TestBulkIngestion)
+{
+    using namespace Clusters::UnitTesting::Attributes;
+
+    constexpr EndpointId kEndpointCount = 3;
+    const uint8_t octets[]              = { 0xAA, 0xAA, 0xAA, 0xAA };
+
+    NullCacheCallback callback;
+    ClusterStateCache cache(callback);
+    cache.SetBulkIngestion(true);
+    ReadClient::Callback & readCallback = cache.GetBufferedCallback();
+
+    // Each value is the data of a structure, as in an AttributeDataIB.
+    std::vector<ConcreteDataAttributePath> paths;
+    System::PacketBufferHandle payload;
+    {
+        System::PacketBufferTLVWriter writer;
+        writer.Init(System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize));
+        for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+        {
+            for (AttributeId attributeId : { Int8u::Id, OctetString::Id })
+            {
+                TLV::TLVType outer;
+                ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+                ASSERT_EQ(writer.Put(TLV::ContextTag(AttributeDataIB::Tag::kDataVersion), DataVersion(1)), CHIP_NO_ERROR);
+                if (attributeId == Int8u::Id)
+                {
+                    ASSERT_EQ(DataModel::Encode(writer, TLV::ContextTag(AttributeDataIB::Tag::kData),
+                                                static_cast<uint8_t>(endpointId + 10)),
+                              CHIP_NO_ERROR);
+                }
+                else
+                {
+                    ASSERT_EQ(DataModel::Encode(writer, TLV::ContextTag(AttributeDataIB::Tag::kData), ByteSpan(octets)),
+                              CHIP_NO_ERROR);
+                }
+                ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+
+                paths.emplace_back(endpointId, Clusters::UnitTesting::Id, attributeId);
+                paths.back().mDataVersion.SetValue(1);
+            }
+        }
+        ASSERT_EQ(writer.Finalize(&payload), CHIP_NO_ERROR);
+    }
+
+    const uint8_t * payloadStart = payload->Start();
+    const uint8_t * payloadEnd   = payloadStart + payload->DataLength();
+
+    readCallback.OnReportPayload(payload);
+    readCallback.OnReportBegin();
+    {
+        System::PacketBufferTLVReader reader;
+        reader.Init(std::move(payload));
+        for (const auto & path : paths)
+        {
+            TLV::TLVType outer;
+            ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+            ASSERT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+            ASSERT_EQ(reader.Next(TLV::ContextTag(AttributeDataIB::Tag::kDataVersion)), CHIP_NO_ERROR);
+            ASSERT_EQ(reader.Next(TLV::ContextTag(AttributeDataIB::Tag::kData)), CHIP_NO_ERROR);
+            readCallback.OnAttributeData(path, &reader, StatusIB());
+            // The report can still be walked through once its values are adopted.
+            ASSERT_EQ(reader.ExitContainer(outer), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+    }
+    readCallback.OnReportEnd();
+
+    for (EndpointId endpointId = 0; endpointId < kEndpointCount; endpointId++)
+    {
+        ConcreteAttributePath path(endpointId, Clusters::UnitTesting::Id, Int8u::Id);
+        uint8_t value = 0;
+        EXPECT_EQ(cache.Get<Int8u::TypeInfo>(path, value), CHIP_NO_ERROR);
+        EXPECT_EQ(value, endpointId + 10);
+
+        TLV::TLVReader reader;
+        ASSERT_EQ(cache.Get(path, reader), CHIP_NO_ERROR);
+        EXPECT_TRUE(reader.GetReadPoint() > payloadStart && reader.GetReadPoint() <= payloadEnd);
+
+        ValidateOctetString(cache, endpointId, 0xAA, sizeof(octets));
+    }
+
+    // Values reported afterwards replace adopted values, and are copied when they are not read from a report buffer.
+    readCallback.OnReportBegin();
+    WriteOctetStringReport(readCallback, 1, 0xBB, 10);
+    readCallback.OnReportEnd();
+    ValidateOctetString(cache, 0, 0xAA, sizeof(octets));
+    ValidateOctetString(cache, 1, 0xBB, 10);
+}
+
 } // namespace
@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/DirtyPathIndex.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using chip::app::reporting::DirtyPathIndex;
+
+class TestDirtyPathIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestDirtyPathIndex, TestConcretePaths)
+{
+    DirtyPathIndex index;
+    ASSERT_EQ(index.Init(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 0u);
+
+    index.Insert(AttributePathParams(1, 6, 0), 2);
+    index.Insert(AttributePathParams(1, 8, 0), 3);
+    index.Insert(AttributePathParams(2, 6, 0), 4);
+    EXPECT_EQ(index.Size(), 3u);
+
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 2u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 8, 0)), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 6, 0)), 4u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 1)), 0u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 8, 0)), 0u);
+
+    // Marking a path dirty again moves its generation forward without adding a path.
+    index.Insert(AttributePathParams(1, 6, 0), 5);
+    EXPECT_EQ(index.Size(), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 5u);
+
+    // List entries are tracked as their whole attribute.
+    index.Insert(AttributePathParams(1, 8, 0, 3), 6);
+    EXPECT_EQ(index.Size(), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 8, 0)), 6u);
+
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 0u);
+}
+
+TEST_F(TestDirtyPathIndex, TestWildcardPaths)
+{
+    DirtyPathIndex index;
+    ASSERT_EQ(index.Init(), CHIP_NO_ERROR);
+
+    index.Insert(AttributePathParams(EndpointId(1), kInvalidClusterId), 2);
+    index.Insert(AttributePathParams(ClusterId(6), AttributeId(0)), 3);
+    index.Insert(AttributePathParams(EndpointId(2), ClusterId(6)), 4);
+    index.Insert(AttributePathParams(2, 6, 1), 5);
+
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 8, 1)), 2u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(3, 6, 0)), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(3, 6, 1)), 0u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 6, 2)), 4u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 6, 1)), 5u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 8, 1)), 0u);
+
+    // The all-wildcard path replaces every other path.
+    index.Insert(AttributePathParams(), 6);
+    EXPECT_EQ(index.Size(), 1u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(3, 8, 1)), 6u);
+
+    // Paths marked dirty afterwards keep their own generation.
+    index.Insert(AttributePathParams(1, 6, 0), 7);
+    EXPECT_EQ(index.Size(), 2u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), 7u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 1)), 6u);
+}
+
+TEST_F(TestDirtyPathIndex, TestMergeWhenFull)
+{
+    DirtyPathIndex index;
+    ASSERT_EQ(index.Init(), CHIP_NO_ERROR);
+
+    // Fill the set with one path on endpoint 2, and the others in cluster 6 of endpoint 1.
+    index.Insert(AttributePathParams(2, 6, 0), 1);
+    for (AttributeId i = 1; i < CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        index.Insert(AttributePathParams(1, 6, i), 1 + i);
+    }
+    EXPECT_EQ(index.Size(), static_cast<size_t>(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET));
+
+    // Cluster 6 of endpoint 1 is merged into a single path, which keeps the latest generation of the merged paths.
+    const uint64_t generation = CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1;
+    index.Insert(AttributePathParams(1, 8, 0), generation);
+    EXPECT_EQ(index.Size(), 3u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 1)), generation - 1);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), generation - 1);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 8, 0)), generation);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 8, 1)), 0u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 6, 0)), 1u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(2, 6, 1)), 0u);
+
+    bool found = false;
+    index.ForEachPath([&](const DirtyPathIndex::DirtyPath * path) {
+        found = found || (static_cast<const AttributePathParams &>(*path) == AttributePathParams(EndpointId(1), ClusterId(6)));
+        return Loop::Continue;
+    });
+    EXPECT_TRUE(found);
+}
+
+TEST_F(TestDirtyPathIndex, TestMergeAllWhenFull)
+{
+    DirtyPathIndex index;
+    ASSERT_EQ(index.Init(), CHIP_NO_ERROR);
+
+    for (EndpointId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        index.Insert(AttributePathParams(i, 6, 0), i);
+    }
+
+    // No two paths share an endpoint, so the whole set collapses into the all-wildcard path.
+    const uint64_t generation = CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1;
+    index.Insert(AttributePathParams(EndpointId(generation), 6, 0), generation);
+    EXPECT_EQ(index.Size(), 1u);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(1, 6, 0)), generation);
+    EXPECT_EQ(index.GetDirtyGeneration(ConcreteAttributePath(0, 29, 0)), generation);
+
+    index.ForEachPath([&](const DirtyPathIndex::DirtyPath * path) {
+        EXPECT_TRUE(static_cast<const AttributePathParams &>(*path) == AttributePathParams());
+        EXPECT_EQ(path->mGeneration, generation);
+        return Loop::Continue;
+    });
+}
+
+} // namespace
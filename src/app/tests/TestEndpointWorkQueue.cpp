@@ -0,0 +1,204 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EndpointWorkQueue.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+constexpr auto kWaitTimeout = std::chrono::seconds(10);
+
+struct WorkLog
+{
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mReleased = false;
+    std::vector<EndpointId> mDone;
+
+    template <typename Predicate>
+    bool WaitFor(Predicate && predicate)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        return mCondition.wait_for(lock, kWaitTimeout, std::forward<Predicate>(predicate));
+    }
+};
+
+class TestWork : public EndpointWork
+{
+public:
+    TestWork(WorkLog & log, bool blocks = false) : mLog(log), mBlocks(blocks) {}
+
+    void Run() override
+    {
+        if (mBlocks)
+        {
+            mLog.WaitFor([this] { return mLog.mReleased; });
+        }
+    }
+
+    void OnWorkDone() override
+    {
+        std::lock_guard<std::mutex> lock(mLog.mMutex);
+        mLog.mDone.push_back(GetEndpointId());
+        mDoneIndex = mLog.mDone.size();
+        mLog.mCondition.notify_all();
+    }
+
+    size_t mDoneIndex = 0;
+
+private:
+    WorkLog & mLog;
+    bool mBlocks;
+};
+
+// Fails to schedule background work, so that the queue has to run the work on the event loop.
+class NoBackgroundWorkScheduler : public EndpointWorkQueue::Scheduler
+{
+public:
+    CHIP_ERROR ScheduleBackgroundWork(AsyncWorkFunct aWork, intptr_t aArg) override { return CHIP_ERROR_NO_MEMORY; }
+    CHIP_ERROR ScheduleWork(AsyncWorkFunct aWork, intptr_t aArg) override { return PlatformMgr().ScheduleWork(aWork, aArg); }
+};
+
+class TestEndpointWorkQueue : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+        ASSERT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        PlatformMgr().StopEventLoopTask();
+        PlatformMgr().Shutdown();
+        chip::Platform::MemoryShutdown();
+    }
+
+    static void Enqueue(EndpointWorkQueue & queue, EndpointId endpointId, EndpointWork & work)
+    {
+        PlatformMgr().LockChipStack();
+        queue.Enqueue(endpointId, work);
+        PlatformMgr().UnlockChipStack();
+    }
+
+    static bool HasPendingWork(EndpointWorkQueue & queue)
+    {
+        PlatformMgr().LockChipStack();
+        bool pending = queue.HasPendingWork();
+        PlatformMgr().UnlockChipStack();
+        return pending;
+    }
+};
+
+TEST_F(TestEndpointWorkQueue, TestWorkOfEndpointRunsInOrder)
+{
+    EndpointWorkQueue queue;
+    WorkLog log;
+    log.mReleased = true;
+    TestWork first(log);
+    TestWork second(log);
+    TestWork third(log);
+
+    Enqueue(queue, 1, first);
+    Enqueue(queue, 1, second);
+    Enqueue(queue, 1, third);
+
+    EXPECT_TRUE(log.WaitFor([&log] { return log.mDone.size() == 3; }));
+    EXPECT_EQ(first.mDoneIndex, 1u);
+    EXPECT_EQ(second.mDoneIndex, 2u);
+    EXPECT_EQ(third.mDoneIndex, 3u);
+    EXPECT_FALSE(HasPendingWork(queue));
+}
+
+TEST_F(TestEndpointWorkQueue, TestWorkRunsWithoutBackgroundWork)
+{
+    NoBackgroundWorkScheduler scheduler;
+    EndpointWorkQueue queue(scheduler);
+    WorkLog log;
+    log.mReleased = true;
+    TestWork first(log);
+    TestWork second(log);
+
+    PlatformMgr().LockChipStack();
+    queue.Enqueue(1, first);
+    queue.Enqueue(1, second);
+    {
+        // The work ran, but its completion still goes through the event loop.
+        std::lock_guard<std::mutex> lock(log.mMutex);
+        EXPECT_TRUE(log.mDone.empty());
+    }
+    PlatformMgr().UnlockChipStack();
+
+    EXPECT_TRUE(log.WaitFor([&log] { return log.mDone.size() == 2; }));
+    EXPECT_EQ(first.mDoneIndex, 1u);
+    EXPECT_EQ(second.mDoneIndex, 2u);
+    EXPECT_FALSE(HasPendingWork(queue));
+}
+
+TEST_F(TestEndpointWorkQueue, TestSlowEndpointDoesNotBlockOthers)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (EndpointWorkQueue::kMaxRunningWork < 2)
+    {
+        GTEST_SKIP() << "Needs at least two background tasks";
+    }
+
+    EndpointWorkQueue queue;
+    WorkLog log;
+    TestWork slow(log, /* blocks = */ true);
+    TestWork afterSlow(log);
+    TestWork other(log);
+
+    Enqueue(queue, 1, slow);
+    Enqueue(queue, 1, afterSlow);
+    Enqueue(queue, 2, other);
+
+    // The work of endpoint 2 completes while endpoint 1 is still busy.
+    EXPECT_TRUE(log.WaitFor([&log] { return log.mDone.size() == 1; }));
+    EXPECT_EQ(other.mDoneIndex, 1u);
+    EXPECT_EQ(afterSlow.mDoneIndex, 0u);
+    EXPECT_TRUE(HasPendingWork(queue));
+
+    {
+        std::lock_guard<std::mutex> lock(log.mMutex);
+        log.mReleased = true;
+        log.mCondition.notify_all();
+    }
+
+    EXPECT_TRUE(log.WaitFor([&log] { return log.mDone.size() == 3; }));
+    EXPECT_EQ(slow.mDoneIndex, 2u);
+    EXPECT_EQ(afterSlow.mDoneIndex, 3u);
+    EXPECT_FALSE(HasPendingWork(queue));
+#else
+    GTEST_SKIP() << "Needs background event processing";
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+}
+
+} // namespace
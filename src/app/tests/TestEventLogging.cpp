@@ -283,4 +283,96 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+TEST_F(TestEventLogging, TestFetchEventsSinceAfterEviction)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    TestEventGenerator testEventGenerator;
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    path.mValue.mEndpointId = kTestEndpointId1;
+    path.mValue.mClusterId  = kLivenessClusterId;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    // Fill the three buffers, then keep logging so that events get evicted and the buffers wrap around. The events
+    // fetched since any event number must be the same whether reading starts from an indexed event or not.
+    for (int32_t i = 0; i < 15; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+        EXPECT_EQ(eid, static_cast<chip::EventNumber>(i));
+
+        // Each buffer holds three events.
+        const chip::EventNumber oldestEventNumber = (eid >= 8) ? eid - 8 : 0;
+        for (chip::EventNumber since = oldestEventNumber; since <= eid; since++)
+        {
+            CheckLogReadOut(logMgmt, since, static_cast<size_t>(eid - since + 1), &path);
+        }
+    }
+}
+
+TEST_F(TestEventLogging, TestEventsKeptAcrossRestart)
+{
+    chip::EventNumber eid;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    TestEventGenerator testEventGenerator;
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    path.mValue.mEndpointId = kTestEndpointId1;
+    path.mValue.mClusterId  = kLivenessClusterId;
+
+    // The buffers and their states stand for storage that outlives the process, e.g. a memory-mapped file.
+    chip::app::CircularEventBufferState states[3] = {};
+
+    const chip::app::LogStorageResources logStorageResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug, &states[0] },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info, &states[1] },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical, &states[2] },
+    };
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+    chip::app::EventManagement::DestroyEventManagement();
+    ASSERT_EQ(eventCounter.Init(0), CHIP_NO_ERROR);
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources),
+                                                      gCircularEventBuffer, logStorageResources, &eventCounter);
+
+    // Two events end up in the Info buffer and three in the Debug buffer.
+    for (int32_t i = 0; i < 5; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+    CheckLogReadOut(logMgmt, 0, 5, &path);
+
+    // Restart over the same storage; event numbers continue past the ones already stored, as they would with a
+    // persisted counter.
+    chip::app::EventManagement::DestroyEventManagement();
+    ASSERT_EQ(eventCounter.Init(100), CHIP_NO_ERROR);
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources),
+                                                      gCircularEventBuffer, logStorageResources, &eventCounter);
+    CheckLogReadOut(logMgmt, 0, 5, &path);
+    CheckLogReadOut(logMgmt, 3, 2, &path);
+
+    testEventGenerator.SetStatus(5);
+    EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    EXPECT_EQ(eid, static_cast<chip::EventNumber>(100));
+    CheckLogReadOut(logMgmt, 0, 6, &path);
+    CheckLogReadOut(logMgmt, 100, 1, &path);
+
+    // A state that does not cover whole events, e.g. after a crash in the middle of an update, drops the events of
+    // that buffer only.
+    chip::app::EventManagement::DestroyEventManagement();
+    states[0].mHeadOffset = (states[0].mHeadOffset + 1) % static_cast<uint32_t>(sizeof(gDebugEventBuffer));
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources),
+                                                      gCircularEventBuffer, logStorageResources, &eventCounter);
+    EXPECT_EQ(states[0].mDataLength, 0u);
+    CheckLogReadOut(logMgmt, 0, 3, &path);
+}
+
 } // namespace
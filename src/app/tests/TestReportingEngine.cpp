@@ -73,7 +73,7 @@ public:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
 
     void TestBuildAndSendSingleReportData();
-    void TestMergeOverlappedAttributePath();
+    void TestOverlappedDirtyPathGenerations();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
 
 private:
@@ -114,7 +114,7 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
     const int size                        = sizeof...(args);
     ExpectedDirtySetContent content[size] = { ExpectedDirtySetContent(args)... };
 
-    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+    if (InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ForEachPath([&](auto * path) {
             for (int i = 0; i < size; i++)
             {
                 if (static_cast<AttributePathParams>(content[i]) == static_cast<AttributePathParams>(*path))
@@ -146,11 +146,11 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    Engine & engine   = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    const size_t size = engine.mGlobalDirtySet.Size();
+    engine.mGlobalDirtySet.Insert(aPath, engine.GetDirtySetGeneration());
+    // The path must have been stored as-is, without merging any path.
+    return engine.mGlobalDirtySet.Size() == size + 1;
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -195,59 +195,44 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
     DrainAndServiceIO();
 }
 
-TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestOverlappedDirtyPathGenerations)
 {
     EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 3;
-        EXPECT_FALSE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 1;
-        testClusterInfo.mListIndex   = 2;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
-    }
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    engine.BumpDirtySetGeneration();
+    engine.InsertPathIntoDirtySet(AttributePathParams(1, 1, 1));
+
+    // A dirty list entry is tracked as its whole attribute.
+    engine.BumpDirtySetGeneration();
+    engine.InsertPathIntoDirtySet(AttributePathParams(1, 1, 1, 2));
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(1, 1, 1)));
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 1)), engine.GetDirtySetGeneration());
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 3)), 0u);
+
+    // A wildcard path is stored next to the paths it covers, which keep their own generation.
+    engine.BumpDirtySetGeneration();
+    engine.InsertPathIntoDirtySet(AttributePathParams(EndpointId(1), ClusterId(1)));
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(1, 1, 1), AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 1)), engine.GetDirtySetGeneration());
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 3)), engine.GetDirtySetGeneration());
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 2, 1)), 0u);
+
+    engine.BumpDirtySetGeneration();
+    engine.InsertPathIntoDirtySet(AttributePathParams(1, 1, 1));
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 1)), engine.GetDirtySetGeneration());
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(1, 1, 3)), engine.GetDirtySetGeneration() - 1);
+
+    // The all-wildcard path replaces every other path.
+    engine.BumpDirtySetGeneration();
+    engine.InsertPathIntoDirtySet(AttributePathParams());
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
+    EXPECT_EQ(engine.mGlobalDirtySet.GetDirtyGeneration(ConcreteAttributePath(2, 2, 2)), engine.GetDirtySetGeneration());
 
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = kInvalidEndpointId;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
-    }
-    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+    engine.Shutdown();
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolExhausted)
@@ -256,7 +241,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.Clear();
     InteractionModelEngine::GetInstance()->GetReportingEngine().BumpDirtySetGeneration();
 
     // Case 1: All dirty paths including the new one are under the same cluster.
@@ -265,12 +250,11 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     {
         EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
+    InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
+        AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.Clear();
 
     // Case 2: All dirty paths including the new one are under the same endpoint.
     // -> Expected behavior: The dirty set is replaced by a wildcard cluster path under the same endpoint.
@@ -278,12 +262,11 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     {
         EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1)));
+    InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
+        AttributePathParams(kTestEndpointId, ClusterId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.Clear();
 
     // Case 3: All dirty paths including the new one are under the different endpoints.
     // -> Expected behavior: The dirty set is replaced by a wildcard endpoint.
@@ -291,12 +274,11 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     {
         EXPECT_TRUE(InsertToDirtySet(AttributePathParams(EndpointId(i), i, i)));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1)));
+    InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
+        AttributePathParams(EndpointId(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1), 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.Clear();
 
     // Case 4: All existing dirty paths are under the same cluster, the new path comes from another cluster.
     // -> Expected behavior: The existing paths are merged into one single wildcard attribute path. New path is inserted
@@ -305,13 +287,12 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     {
         EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
+        AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId),
                                       AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
-    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
+    InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.Clear();
 
     // Case 5: All existing dirty paths are under the same endpoint, the new path comes from another endpoint.
     // -> Expected behavior: The existing paths are merged into one single wildcard cluster path. New path is inserted as-is.
@@ -319,9 +300,8 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     {
         EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, i, 1)));
     }
-    EXPECT_EQ(CHIP_NO_ERROR,
-              InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
-                  AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
+    InteractionModelEngine::GetInstance()->GetReportingEngine().InsertPathIntoDirtySet(
+        AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1));
     EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kInvalidClusterId),
                                       AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
@@ -60,13 +60,14 @@ CHIP_ERROR DeviceControllerFactory::Init(FactoryInitParams params)
 
     // Save our initialization state that we can't recover later from a
     // created-but-shut-down system state.
-    mListenPort                = params.listenPort;
-    mFabricIndependentStorage  = params.fabricIndependentStorage;
-    mOperationalKeystore       = params.operationalKeystore;
-    mOpCertStore               = params.opCertStore;
-    mCertificateValidityPolicy = params.certificateValidityPolicy;
-    mSessionResumptionStorage  = params.sessionResumptionStorage;
-    mEnableServerInteractions  = params.enableServerInteractions;
+    mListenPort                 = params.listenPort;
+    mFabricIndependentStorage   = params.fabricIndependentStorage;
+    mOperationalKeystore        = params.operationalKeystore;
+    mOpCertStore                = params.opCertStore;
+    mCertificateValidityPolicy  = params.certificateValidityPolicy;
+    mSessionResumptionStorage   = params.sessionResumptionStorage;
+    mEnableServerInteractions   = params.enableServerInteractions;
+    mPersistAddressResolveCache = params.persistAddressResolveCache;
 
     // Initialize the system state. Note that it is left in a somewhat
     // special state where it is initialized, but has a ref count of 0.
@@ -89,16 +90,17 @@ CHIP_ERROR DeviceControllerFactory::ReinitSystemStateIfNecessary()
 #if CONFIG_NETWORK_LAYER_BLE
     params.bleLayer = mSystemState->BleLayer();
 #endif
-    params.listenPort                = mListenPort;
-    params.fabricIndependentStorage  = mFabricIndependentStorage;
-    params.enableServerInteractions  = mEnableServerInteractions;
-    params.groupDataProvider         = mSystemState->GetGroupDataProvider();
-    params.sessionKeystore           = mSystemState->GetSessionKeystore();
-    params.fabricTable               = mSystemState->Fabrics();
-    params.operationalKeystore       = mOperationalKeystore;
-    params.opCertStore               = mOpCertStore;
-    params.certificateValidityPolicy = mCertificateValidityPolicy;
-    params.sessionResumptionStorage  = mSessionResumptionStorage;
+    params.listenPort                 = mListenPort;
+    params.fabricIndependentStorage   = mFabricIndependentStorage;
+    params.enableServerInteractions   = mEnableServerInteractions;
+    params.persistAddressResolveCache = mPersistAddressResolveCache;
+    params.groupDataProvider          = mSystemState->GetGroupDataProvider();
+    params.sessionKeystore            = mSystemState->GetSessionKeystore();
+    params.fabricTable                = mSystemState->Fabrics();
+    params.operationalKeystore        = mOperationalKeystore;
+    params.opCertStore                = mOpCertStore;
+    params.certificateValidityPolicy  = mCertificateValidityPolicy;
+    params.sessionResumptionStorage   = mSessionResumptionStorage;
 
     return InitSystemState(params);
 }
@@ -294,6 +296,10 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     // TODO: Need to be able to create a CASESessionManagerConfig here!
     stateParams.caseSessionManager = Platform::New<CASESessionManager>();
     ReturnErrorOnFailure(stateParams.caseSessionManager->Init(stateParams.systemLayer, sessionManagerConfig));
+    if (params.persistAddressResolveCache)
+    {
+        AddressResolve::Resolver::Instance().SetPersistentStorage(params.fabricIndependentStorage);
+    }
 
     ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->Init(
         stateParams.exchangeMgr, stateParams.fabricTable, stateParams.reportScheduler, stateParams.caseSessionManager));
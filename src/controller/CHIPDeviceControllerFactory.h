@@ -157,6 +157,12 @@ struct FactoryInitParams
     //
     bool enableServerInteractions = false;
 
+    //
+    // Keeps the addresses of the nodes resolved through DNS-SD in fabricIndependentStorage,
+    // so that reconnecting to them after a restart does not have to wait for DNS-SD.
+    //
+    bool persistAddressResolveCache = false;
+
     /* The port used for operational communication to listen for and send messages over UDP/TCP.
      * The default value of `0` will pick any available port. */
     uint16_t listenPort = 0;
@@ -293,6 +299,7 @@ private:
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     bool mEnableServerInteractions                                      = false;
+    bool mPersistAddressResolveCache                                    = false;
 };
 
 } // namespace Controller
@@ -32,6 +32,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/tests/AppTestContext.h>
 #include <app/util/attribute-storage.h>
+#include <app/util/endpoint-config-api.h>
 #include <controller/InvokeInteraction.h>
 #include <controller/ReadInteraction.h>
 #include <lib/core/ErrorStr.h>
@@ -367,4 +368,37 @@ TEST_F(TestServerCommandDispatch, TestDataResponseHandlerOverride2)
     TestDataResponseHelper(&testEndpoint3, true);
 }
 
+TEST_F(TestServerCommandDispatch, TestDynamicEndpointLookup)
+{
+    constexpr EndpointId kFirstId  = 0x1234;
+    constexpr EndpointId kSecondId = 0x0123;
+
+    DataVersion dataVersionStorage[ArraySize(testEndpointClusters3)];
+    EXPECT_EQ(emberAfSetDynamicEndpoint(0, kFirstId, &testEndpoint3, Span<DataVersion>(dataVersionStorage)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kFirstId), 0);
+    EXPECT_NE(emberAfIndexFromEndpoint(kFirstId), kEmberInvalidEndpointIndex);
+    EXPECT_NE(emberAfFindServerCluster(kFirstId, Clusters::Descriptor::Id), nullptr);
+    EXPECT_NE(emberAfLocateAttributeMetadata(kFirstId, Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::ServerList::Id),
+              nullptr);
+
+    // The same endpoint id cannot be registered twice.
+    EXPECT_EQ(emberAfSetDynamicEndpoint(0, kFirstId, &testEndpoint3, Span<DataVersion>(dataVersionStorage)),
+              CHIP_ERROR_ENDPOINT_EXISTS);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kFirstId);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kFirstId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kFirstId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfFindServerCluster(kFirstId, Clusters::Descriptor::Id), nullptr);
+
+    // Reusing the slot under another id must only make the new id resolvable.
+    EXPECT_EQ(emberAfSetDynamicEndpoint(0, kSecondId, &testEndpoint3, Span<DataVersion>(dataVersionStorage)), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kSecondId), 0);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kFirstId), kEmberInvalidEndpointIndex);
+    EXPECT_NE(emberAfFindServerCluster(kSecondId, Clusters::UnitTesting::Id), nullptr);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kSecondId);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kSecondId), kEmberInvalidEndpointIndex);
+}
+
 } // namespace
@@ -25,6 +25,7 @@
 #include <app/AttributeValueEncoder.h>
 #include <app/InteractionModelEngine.h>
 #include <app/codegen-data-model-provider/Instance.h>
+#include <lib/support/CHIPMem.h>
 
 using namespace chip;
 using namespace chip::app;
@@ -66,6 +67,82 @@ ScopedChangeOnly<bool> gIsLitIcd(false);
 uint16_t gInt16uTotalReadCount = 0;
 CommandHandler::Handle gAsyncCommandHandle;
 
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+Optional<uint16_t> gFetchedInt16u;
+ManualEndpointWorkScheduler gEndpointWorkScheduler;
+EndpointWorkQueue gEndpointWorkQueue(gEndpointWorkScheduler);
+
+CHIP_ERROR ManualEndpointWorkScheduler::ScheduleBackgroundWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg)
+{
+    mBackgroundWork.emplace_back(aWork, aArg);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ManualEndpointWorkScheduler::ScheduleWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg)
+{
+    System::Layer * systemLayer = InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer();
+    return systemLayer->ScheduleLambda([aWork, aArg] { aWork(aArg); });
+}
+
+size_t ManualEndpointWorkScheduler::RunBackgroundWork()
+{
+    auto backgroundWork = std::move(mBackgroundWork);
+    mBackgroundWork.clear();
+    for (auto & work : backgroundWork)
+    {
+        work.first(work.second);
+    }
+    return backgroundWork.size();
+}
+
+namespace {
+
+// Fetches Int16u as a bridge would from its bridged device, for kSendDataAfterEndpointWork.
+class FetchInt16uWork : public EndpointWork
+{
+public:
+    void Run() override { mValue = kEndpointWorkInt16uValue; }
+
+    void OnWorkDone() override
+    {
+        gFetchedInt16u.SetValue(mValue);
+        mPending = false;
+    }
+
+    bool mPending   = false;
+    uint16_t mValue = 0;
+};
+
+FetchInt16uWork gFetchInt16uWork;
+
+// Completes a command once it has run, for kAsyncEndpointWork.
+class InvokeWork : public EndpointWork
+{
+public:
+    InvokeWork(CommandHandler * aCommandHandler, const ConcreteCommandPath & aPath) : mHandle(aCommandHandler), mPath(aPath) {}
+
+    void Run() override {}
+
+    void OnWorkDone() override
+    {
+        CommandHandler * commandHandler = mHandle.Get();
+        if (commandHandler != nullptr)
+        {
+            commandHandler->AddStatus(mPath, Protocols::InteractionModel::Status::Success);
+        }
+
+        // Releases the handle, which sends the invoke response.
+        Platform::Delete(this);
+    }
+
+private:
+    CommandHandler::Handle mHandle;
+    ConcreteCommandPath mPath;
+};
+
+} // namespace
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
 } // namespace DataModelTests
 
 CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
@@ -99,7 +176,31 @@ CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescr
         return CHIP_NO_ERROR;
     }
 
-    if (gReadResponseDirective == ReadResponseDirective::kSendDataResponse)
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+    if (gReadResponseDirective == ReadResponseDirective::kSendDataAfterEndpointWork &&
+        aPath.mClusterId == app::Clusters::UnitTesting::Id &&
+        aPath.mAttributeId == app::Clusters::UnitTesting::Attributes::Int16u::Id)
+    {
+        if (!gFetchedInt16u.HasValue())
+        {
+            // Fetch the value once, however many times it is read meanwhile.
+            if (!gFetchInt16uWork.mPending)
+            {
+                gFetchInt16uWork.mPending = true;
+                gEndpointWorkQueue.Enqueue(aPath.mEndpointId, gFetchInt16uWork);
+            }
+            return CHIP_ERROR_IN_PROGRESS;
+        }
+
+        AttributeEncodeState state(apEncoderState);
+        AttributeValueEncoder valueEncoder(aAttributeReports, aSubjectDescriptor, aPath, kDataVersion, aIsFabricFiltered, state);
+
+        return valueEncoder.Encode(gFetchedInt16u.Value());
+    }
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
+    if (gReadResponseDirective == ReadResponseDirective::kSendDataResponse ||
+        gReadResponseDirective == ReadResponseDirective::kSendDataAfterEndpointWork)
     {
         if (aPath.mClusterId == app::Clusters::UnitTesting::Id &&
             aPath.mAttributeId == app::Clusters::UnitTesting::Attributes::ListFabricScoped::Id)
@@ -465,6 +566,18 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
         {
             gAsyncCommandHandle = apCommandObj;
         }
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+        else if (gCommandResponseDirective == CommandResponseDirective::kAsyncEndpointWork)
+        {
+            auto * work = Platform::New<InvokeWork>(apCommandObj, aCommandPath);
+            if (work == nullptr)
+            {
+                apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::ResourceExhausted);
+                return;
+            }
+            gEndpointWorkQueue.Enqueue(aCommandPath.mEndpointId, *work);
+        }
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
     }
 }
 
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <app/AppConfig.h>
 #include <app/CommandHandler.h>
 #include <app/data-model-provider/Provider.h>
 #include <app/util/mock/Constants.h>
@@ -28,6 +29,14 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Scoped.h>
 
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+#include <app/EndpointWorkQueue.h>
+#include <lib/core/Optional.h>
+
+#include <utility>
+#include <vector>
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
 namespace chip {
 namespace app {
 namespace DataModelTests {
@@ -59,6 +68,9 @@ enum class ReadResponseDirective
     kSendDataError,
     kSendTwoDataErrors, // Multiple errors, for a single concrete path,
                         // simulating a malicious server.
+    kSendDataAfterEndpointWork, // Like kSendDataResponse, except that Int16u is fetched by
+                                // work queued on gEndpointWorkQueue: its reads are suspended
+                                // until that work is done.
 };
 extern ScopedChangeOnly<ReadResponseDirective> gReadResponseDirective;
 
@@ -92,12 +104,41 @@ enum class CommandResponseDirective
     kSendSuccessStatusCodeWithClusterStatus,
     kSendErrorWithClusterStatus,
     kAsync,
+    kAsyncEndpointWork, // Send a success status code once work queued on gEndpointWorkQueue is done.
 };
 extern ScopedChangeOnly<CommandResponseDirective> gCommandResponseDirective;
 
 // Populated with the command handle when gCommandResponseDirective == kAsync
 extern CommandHandler::Handle gAsyncCommandHandle;
 
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+// The value of Int16u fetched by the endpoint work of kSendDataAfterEndpointWork
+constexpr uint16_t kEndpointWorkInt16uValue = 0x1234;
+
+// Set once the endpoint work of kSendDataAfterEndpointWork is done; reads of Int16u are suspended until then.
+extern Optional<uint16_t> gFetchedInt16u;
+
+/// Runs the background work of an EndpointWorkQueue only when the test asks for it, and hands the work back
+/// to the event loop of the test context.
+class ManualEndpointWorkScheduler : public EndpointWorkQueue::Scheduler
+{
+public:
+    CHIP_ERROR ScheduleBackgroundWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) override;
+    CHIP_ERROR ScheduleWork(DeviceLayer::AsyncWorkFunct aWork, intptr_t aArg) override;
+
+    /// Runs the background work scheduled so far, and returns how many items were run.
+    size_t RunBackgroundWork();
+
+private:
+    std::vector<std::pair<DeviceLayer::AsyncWorkFunct, intptr_t>> mBackgroundWork;
+};
+
+extern ManualEndpointWorkScheduler gEndpointWorkScheduler;
+
+// The queue of kSendDataAfterEndpointWork and kAsyncEndpointWork, running on gEndpointWorkScheduler.
+extern EndpointWorkQueue gEndpointWorkQueue;
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
 /// A customized class for read/write/invoke that matches functionality
 /// with the ember-compatibility-functions functionality here.
 ///
@@ -234,6 +234,53 @@ TEST_F(TestCommands, TestAsyncResponse)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+TEST_F(TestCommands, TestAsyncResponseFromEndpointWork)
+{
+    struct FakeRequest : public Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type
+    {
+        using ResponseType = DataModel::NullObjectType;
+    };
+
+    FakeRequest request;
+    auto sessionHandle = GetSessionBobToAlice();
+
+    bool onSuccessWasCalled = false;
+    bool onFailureWasCalled = false;
+    bool statusCheck        = false;
+    request.arg1            = true;
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onSuccessCb = [&onSuccessWasCalled, &statusCheck](const app::ConcreteCommandPath & commandPath,
+                                                           const app::StatusIB & aStatus, const auto & dataResponse) {
+        statusCheck        = (aStatus.mStatus == Protocols::InteractionModel::Status::Success);
+        onSuccessWasCalled = true;
+    };
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onFailureCb = [&onFailureWasCalled](CHIP_ERROR aError) { onFailureWasCalled = true; };
+
+    ScopedChange directive(gCommandResponseDirective, CommandResponseDirective::kAsyncEndpointWork);
+
+    chip::Controller::InvokeCommandRequest(&GetExchangeManager(), sessionHandle, kTestEndpointId, request, onSuccessCb,
+                                           onFailureCb);
+
+    DrainAndServiceIO();
+
+    // The invoke response waits for the endpoint work.
+    EXPECT_TRUE(!onSuccessWasCalled && !onFailureWasCalled && !statusCheck);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 2u);
+
+    EXPECT_EQ(gEndpointWorkScheduler.RunBackgroundWork(), 1u);
+    DrainAndServiceIO();
+
+    EXPECT_TRUE(onSuccessWasCalled && !onFailureWasCalled && statusCheck);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
 TEST_F(TestCommands, TestFailure)
 {
     Clusters::UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
@@ -4669,6 +4669,126 @@ TEST_F(TestRead, TestReadAttribute_ManyErrors)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+#if CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+TEST_F(TestRead, TestReadAttribute_SuspendedOnEndpointWork)
+{
+    auto sessionHandle  = GetSessionBobToAlice();
+    size_t successCalls = 0;
+    size_t failureCalls = 0;
+    uint16_t value      = 0;
+
+    ScopedChange directive(gReadResponseDirective, ReadResponseDirective::kSendDataAfterEndpointWork);
+    gFetchedInt16u.ClearValue();
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onSuccessCb = [&successCalls, &value](const app::ConcreteDataAttributePath & attributePath, const auto & dataResponse) {
+        value = dataResponse;
+        ++successCalls;
+    };
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onFailureCb = [&failureCalls](const app::ConcreteDataAttributePath * attributePath, CHIP_ERROR aError) { ++failureCalls; };
+
+    Controller::ReadAttribute<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(&GetExchangeManager(), sessionHandle,
+                                                                                   kTestEndpointId, onSuccessCb, onFailureCb);
+
+    DrainAndServiceIO();
+
+    // The report waits for the endpoint work that fetches the value.
+    EXPECT_EQ(successCalls, 0u);
+    EXPECT_EQ(failureCalls, 0u);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 1u);
+
+    EXPECT_EQ(gEndpointWorkScheduler.RunBackgroundWork(), 1u);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(successCalls, 1u);
+    EXPECT_EQ(failureCalls, 0u);
+    EXPECT_EQ(value, kEndpointWorkInt16uValue);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients(), 0u);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestRead, TestReadAttribute_ChunkSentBeforeEndpointWork)
+{
+    ScopedChange directive(gReadResponseDirective, ReadResponseDirective::kSendDataAfterEndpointWork);
+    gFetchedInt16u.ClearValue();
+
+    // The paths are reported in the reverse order of the request: Boolean, which is available, then Int16u, which is fetched
+    // by endpoint work.
+    app::AttributePathParams attributePathParams[] = {
+        app::AttributePathParams(kTestEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id),
+        app::AttributePathParams(kTestEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Boolean::Id),
+    };
+
+    TestReadCallback readCallback;
+    app::ReadPrepareParams readParam(GetSessionBobToAlice());
+    readParam.mpAttributePathParamsList    = attributePathParams;
+    readParam.mAttributePathParamsListSize = ArraySize(attributePathParams);
+
+    app::ReadClient readClient(app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), readCallback,
+                               app::ReadClient::InteractionType::Read);
+    EXPECT_EQ(readClient.SendRequest(readParam), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    // Boolean went out in a first chunk, and the rest of the report waits for the endpoint work.
+    EXPECT_EQ(readCallback.mAttributeCount, 1u);
+    EXPECT_EQ(readCallback.mOnReportEnd, 0u);
+    EXPECT_EQ(readCallback.mOnDone, 0u);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 1u);
+
+    EXPECT_EQ(gEndpointWorkScheduler.RunBackgroundWork(), 1u);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(readCallback.mAttributeCount, 2u);
+    EXPECT_EQ(readCallback.mOnReportEnd, 1u);
+    EXPECT_EQ(readCallback.mOnDone, 1u);
+    EXPECT_EQ(readCallback.mOnError, 0u);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 0u);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+TEST_F(TestRead, TestSubscribeAttribute_PrimingSuspendedOnEndpointWork)
+{
+    ScopedChange directive(gReadResponseDirective, ReadResponseDirective::kSendDataAfterEndpointWork);
+    gFetchedInt16u.ClearValue();
+
+    TestReadCallback readCallback;
+    app::AttributePathParams pathParams(kTestEndpointId, Clusters::UnitTesting::Id, Clusters::UnitTesting::Attributes::Int16u::Id);
+
+    app::ReadPrepareParams readParam(GetSessionBobToAlice());
+    readParam.mpAttributePathParamsList    = &pathParams;
+    readParam.mAttributePathParamsListSize = 1;
+    readParam.mMinIntervalFloorSeconds     = 0;
+    readParam.mMaxIntervalCeilingSeconds   = 10;
+
+    app::ReadClient readClient(app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), readCallback,
+                               app::ReadClient::InteractionType::Subscribe);
+    EXPECT_EQ(readClient.SendRequest(readParam), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+
+    // The priming report waits for the endpoint work.
+    EXPECT_EQ(readCallback.mAttributeCount, 0u);
+    EXPECT_EQ(readCallback.mOnSubscriptionEstablishedCount, 0u);
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 1u);
+
+    EXPECT_EQ(gEndpointWorkScheduler.RunBackgroundWork(), 1u);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(readCallback.mAttributeCount, 1u);
+    EXPECT_EQ(readCallback.mOnSubscriptionEstablishedCount, 1u);
+    EXPECT_EQ(readCallback.mOnError, 0u);
+
+    app::InteractionModelEngine::GetInstance()->ShutdownActiveReads();
+    EXPECT_EQ(app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers(), 0u);
+}
+#endif // CHIP_CONFIG_ENABLE_ENDPOINT_WORK_QUEUE
+
 //
 // This validates the KeepSubscriptions flag by first setting up a valid subscription, then sending
 // a subsequent SubcribeRequest with empty attribute AND event paths with KeepSubscriptions = false.
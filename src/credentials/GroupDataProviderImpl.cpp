@@ -22,6 +22,8 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
+
+#include <algorithm>
 #include <stdlib.h>
 
 namespace chip {
@@ -832,12 +834,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionCache();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionCache();
 }
 
 //
@@ -1349,6 +1353,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1420,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1453,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1530,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1602,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1704,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionCache();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1836,15 +1847,126 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
     return Crypto::AES_CTR_crypt(input.data(), input.size(), mPrivacyKey, nonce.data(), nonce.size(), output.data());
 }
 
+//
+// Group session cache
+//
+
+CHIP_ERROR GroupDataProviderImpl::LoadGroupSessionCache()
+{
+#if CHIP_CONFIG_GROUP_SESSION_CACHE
+    VerifyOrReturnError(!mGroupSessionCacheLoaded, CHIP_NO_ERROR);
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    if (CHIP_ERROR_NOT_FOUND == err)
+    {
+        // No fabric, no session
+        mGroupSessionCacheLoaded = true;
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    // Size the cache for the maximum number of keys of the mapped key sets
+    size_t capacity = 0;
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        capacity += fabric.map_count * KeySet::kEpochKeysMax;
+    }
+    if (capacity > 0)
+    {
+        VerifyOrReturnError(mGroupSessionCache.Calloc(capacity), CHIP_ERROR_NO_MEMORY);
+    }
+
+    fabric.fabric_index = fabric_list.first_entry;
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        SuccessOrExit(err = fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            SuccessOrExit(err = mapping.Load(mStorage));
+
+            KeySetData keyset;
+            VerifyOrExit(keyset.Find(mStorage, fabric, mapping.keyset_id), err = CHIP_ERROR_NOT_FOUND);
+
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                VerifyOrExit(mGroupSessionCacheCount < capacity, err = CHIP_ERROR_INTERNAL);
+
+                // Insert sorted by session id, after the sessions with the same id, to keep the order of the storage
+                GroupSessionCacheEntry * entries = mGroupSessionCache.Get();
+                size_t pos                       = mGroupSessionCacheCount++;
+                for (; pos > 0 && entries[pos - 1].session_id > creds.hash; pos--)
+                {
+                    entries[pos] = entries[pos - 1];
+                }
+                entries[pos].session_id      = creds.hash;
+                entries[pos].fabric_index    = fabric.fabric_index;
+                entries[pos].group_id        = mapping.group_id;
+                entries[pos].security_policy = keyset.policy;
+                memcpy(entries[pos].encryption_key, creds.encryption_key, sizeof(entries[pos].encryption_key));
+                memcpy(entries[pos].privacy_key, creds.privacy_key, sizeof(entries[pos].privacy_key));
+            }
+        }
+    }
+    mGroupSessionCacheLoaded = true;
+
+exit:
+    if (CHIP_NO_ERROR != err)
+    {
+        InvalidateGroupSessionCache();
+    }
+    return err;
+#else
+    return CHIP_NO_ERROR;
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+    // Iterators still referring to the dropped cache stop at their next step
+    mGroupSessionCacheVersion++;
+    if (mGroupSessionCache)
+    {
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mGroupSessionCache.Get()),
+                                mGroupSessionCacheCount * sizeof(GroupSessionCacheEntry));
+        mGroupSessionCache.Free();
+    }
+    mGroupSessionCacheCount  = 0;
+    mGroupSessionCacheLoaded = false;
+}
+
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+    LogErrorOnFailure(LoadGroupSessionCache());
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (provider.mGroupSessionCacheLoaded)
+    {
+        const GroupSessionCacheEntry * begin = provider.mGroupSessionCache.Get();
+        const GroupSessionCacheEntry * end   = begin + provider.mGroupSessionCacheCount;
+
+        auto range = std::equal_range(begin, end, GroupSessionCacheEntry{ session_id, kUndefinedFabricIndex, kUndefinedGroupId },
+                                      [](const GroupSessionCacheEntry & a, const GroupSessionCacheEntry & b) {
+                                          return a.session_id < b.session_id;
+                                      });
+        mUseCache     = true;
+        mCacheVersion = provider.mGroupSessionCacheVersion;
+        mCacheFirst   = static_cast<size_t>(range.first - begin);
+        mCacheIndex   = mCacheFirst;
+        mCacheEnd     = static_cast<size_t>(range.second - begin);
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +1979,11 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+    if (mUseCache)
+    {
+        return mCacheEnd - mCacheFirst;
+    }
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +2025,19 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mUseCache)
+    {
+        VerifyOrReturnError(mCacheVersion == mProvider.mGroupSessionCacheVersion && mCacheIndex < mCacheEnd, false);
+
+        const GroupSessionCacheEntry & entry = mProvider.mGroupSessionCache[mCacheIndex++];
+        mGroupKeyContext.Initialize(entry.encryption_key, mSessionId, entry.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = entry.security_policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
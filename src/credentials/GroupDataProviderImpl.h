@@ -20,6 +20,7 @@
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace Credentials {
@@ -33,7 +34,7 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
+    ~GroupDataProviderImpl() override { InvalidateGroupSessionCache(); }
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -241,8 +242,38 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+        // Range of the matching sessions in the provider's session cache, used instead of the storage when the cache is loaded
+        bool mUseCache         = false;
+        uint32_t mCacheVersion = 0;
+        size_t mCacheFirst     = 0;
+        size_t mCacheIndex     = 0;
+        size_t mCacheEnd       = 0;
         GroupKeyContext mGroupKeyContext;
     };
+
+    /**
+     * A group session, with the keys derived from its epoch key, as kept in the session cache.
+     */
+    struct GroupSessionCacheEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        GroupId group_id;
+        SecurityPolicy security_policy;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+
+    /**
+     * Load the group sessions of all fabrics from storage into the session cache, sorted by session id, unless already loaded.
+     * On failure, the cache is left empty and group sessions are looked up from storage.
+     */
+    CHIP_ERROR LoadGroupSessionCache();
+    /**
+     * Drop the session cache. Must be called before any change to the group key map or the key sets.
+     */
+    void InvalidateGroupSessionCache();
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
@@ -254,6 +285,11 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+
+    Platform::ScopedMemoryBuffer<GroupSessionCacheEntry> mGroupSessionCache;
+    size_t mGroupSessionCacheCount     = 0;
+    bool mGroupSessionCacheLoaded      = false;
+    uint32_t mGroupSessionCacheVersion = 0;
 };
 
 } // namespace Credentials
@@ -28,6 +28,7 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/core/TLV.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <platform/KeyValueStoreManager.h>
 
@@ -1222,6 +1223,71 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionCache)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    auto countSessions = [provider](uint16_t session_id) {
+        GroupSession session;
+        auto it      = provider->IterateGroupSessions(session_id);
+        size_t count = 0;
+        VerifyOrReturnValue(it != nullptr, count);
+        while (it->Next(session))
+        {
+            EXPECT_NE(session.keyContext, nullptr);
+            EXPECT_EQ(session.fabric_index, kFabric1);
+            count++;
+        }
+        EXPECT_EQ(it->Count(), count);
+        it->Release();
+        return count;
+    };
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    EXPECT_EQ(countSessions(session_id), 1u);
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE
+    // Once loaded, the sessions are found without reading the storage
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::FabricKeyset(kFabric1, kKeysetId1).KeyName());
+    EXPECT_EQ(countSessions(session_id), 1u);
+    sDelegate.ClearPoisonKeys();
+#endif
+
+    // Mapping another group to the key set adds a session
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(session_id), 2u);
+
+    // Removing a mapping removes its session
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(session_id), 1u);
+
+    // Keys derived for another compressed fabric id replace the sessions of the key set
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(session_id), 0u);
+
+    key_context = provider->GetKeyContext(kFabric1, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    session_id = key_context->GetKeyHash();
+    key_context->Release();
+    EXPECT_EQ(countSessions(session_id), 1u);
+
+    // Removing the fabric removes all of its sessions
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(session_id), 0u);
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
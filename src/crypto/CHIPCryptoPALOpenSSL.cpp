@@ -146,6 +146,80 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+namespace {
+
+/**
+ * Per-thread AES-128-CCM cipher context shared by AES_CCM_encrypt() and AES_CCM_decrypt().
+ *
+ * Allocating a cipher context and fetching the cipher costs more than encrypting a typical Matter
+ * message, so each thread keeps one context that stays bound to AES-128-CCM. The key still has to be set
+ * for every operation: OpenSSL binds the CCM nonce and tag lengths into the key setup and does not
+ * restore them once an operation completes. After every operation, the key schedule is overwritten
+ * with that of an all-zero key, so that no session key outlives the operation that set it up.
+ */
+class AesCcmContext
+{
+public:
+    AesCcmContext() = default;
+    ~AesCcmContext() { Discard(); }
+
+    AesCcmContext(const AesCcmContext &)             = delete;
+    AesCcmContext & operator=(const AesCcmContext &) = delete;
+
+    /**
+     * Get the context set up for AES-128-CCM, creating it if needed. Returns nullptr if it could not be set up.
+     */
+    EVP_CIPHER_CTX * Acquire()
+    {
+        if (mContext == nullptr)
+        {
+            mContext = EVP_CIPHER_CTX_new();
+            VerifyOrReturnValue(mContext != nullptr, nullptr);
+
+            if (EVP_EncryptInit_ex(mContext, EVP_aes_128_ccm(), nullptr, nullptr, nullptr) != 1)
+            {
+                Discard();
+            }
+        }
+        return mContext;
+    }
+
+    /**
+     * Hand back the context after an operation, clearing the key it was used with.
+     *
+     * A context whose operation failed is discarded, since it may have been left in the middle of an
+     * operation. Freeing a context cleanses its key schedule.
+     */
+    void Release(bool succeeded)
+    {
+        static const uint8_t kZeroKey[kAES_CCM128_Key_Length] = {};
+
+        if (!succeeded || (mContext != nullptr && EVP_EncryptInit_ex(mContext, nullptr, nullptr, kZeroKey, nullptr) != 1))
+        {
+            Discard();
+        }
+    }
+
+private:
+    void Discard()
+    {
+        if (mContext != nullptr)
+        {
+            EVP_CIPHER_CTX_free(mContext);
+            mContext = nullptr;
+        }
+    }
+
+    EVP_CIPHER_CTX * mContext = nullptr;
+};
+
+// OpenSSL cipher contexts must not be shared between threads.
+thread_local AesCcmContext sAesCcmContext;
+
+} // namespace
+#endif // !CHIP_CRYPTO_BORINGSSL
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
@@ -158,7 +232,6 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -213,13 +286,11 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
 
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
+    context = sAesCcmContext.Acquire();
     VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
+    // Select encryption. The context is already set up for the AES-128-CCM cipher.
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, nullptr);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
@@ -273,7 +344,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        sAesCcmContext.Release(error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
         context = nullptr;
     }
@@ -292,7 +363,6 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 
     EVP_CIPHER_CTX * context = nullptr;
     int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif // CHIP_CRYPTO_BORINGSSL
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -343,13 +413,11 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                                       aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
+    context = sAesCcmContext.Acquire();
     VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
+    // Select decryption. The context is already set up for the AES-128-CCM cipher.
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, nullptr);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in nonce length
@@ -402,7 +470,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        sAesCcmContext.Release(error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
 
         context = nullptr;
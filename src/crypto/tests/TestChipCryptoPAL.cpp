@@ -392,6 +392,60 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptTestVectors)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+// Back-to-back operations with the same keys must give the same results as the first ones, including after an
+// operation that failed authentication, since the PAL may reuse cipher contexts between calls.
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128RepeatedKeyUse)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int pass = 0; pass < 3; pass++)
+    {
+        for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+        {
+            const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+            if (vector->pt_len == 0 || vector->result != CHIP_NO_ERROR)
+            {
+                continue;
+            }
+            numOfTestsRan++;
+
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            ASSERT_TRUE(out_ct.Alloc(vector->ct_len));
+            ASSERT_TRUE(out_tag.Alloc(vector->tag_len));
+            ASSERT_TRUE(out_pt.Alloc(vector->pt_len));
+
+            TestAesKey key(vector->key, vector->key_len);
+
+            for (int i = 0; i < 2; i++)
+            {
+                CHIP_ERROR err = AES_CCM_encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, key.key, vector->nonce,
+                                                 vector->nonce_len, out_ct.Get(), out_tag.Get(), vector->tag_len);
+                EXPECT_EQ(err, CHIP_NO_ERROR);
+                EXPECT_EQ(memcmp(out_ct.Get(), vector->ct, vector->ct_len), 0);
+                EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+
+                if (pass == 1)
+                {
+                    // Fail authentication with a corrupted tag before decrypting with the same key.
+                    out_tag[0] ^= 0x01;
+                    err = AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag.Get(),
+                                          vector->tag_len, key.key, vector->nonce, vector->nonce_len, out_pt.Get());
+                    EXPECT_NE(err, CHIP_NO_ERROR);
+                }
+
+                err = AES_CCM_decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                      key.key, vector->nonce, vector->nonce_len, out_pt.Get());
+                EXPECT_EQ(err, CHIP_NO_ERROR);
+                EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+            }
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 TEST_F(TestChipCryptoPAL, TestAES_CCM_128EncryptInvalidNonceLen)
 {
     HeapChecker heapChecker;
@@ -33,6 +33,8 @@
 #include <unistd.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <pthread.h>
 #include <queue>
 
@@ -97,6 +99,13 @@ protected:
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
+#endif
+
     // ===== Methods available to the implementation subclass.
 
 private:
@@ -113,6 +122,22 @@ private:
     static void * EventLoopTaskMain(void * arg);
 #endif
     void ProcessDeviceEvents();
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // Background events are processed by a pool of CHIP_DEVICE_CONFIG_BG_TASK_COUNT tasks, so that long-running work
+    // (e.g. the crypto of concurrent CASE handshakes) is spread over several cores. While the pool is not running,
+    // background events are processed by the CHIP task instead.
+    std::mutex mBackgroundEventQueueLock;
+    std::condition_variable mBackgroundEventQueueCond;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    bool mShouldRunBackgroundEventLoop = false;
+
+    pthread_t mBackgroundEventLoopTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t mBackgroundEventLoopTaskCount = 0;
+
+    static void * BackgroundEventLoopTaskMain(void * arg);
+    void ProcessBackgroundEvents();
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
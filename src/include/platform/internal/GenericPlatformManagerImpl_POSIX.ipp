@@ -35,6 +35,7 @@
 #include <system/SystemError.h>
 #include <system/SystemLayer.h>
 
+#include <algorithm>
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -303,6 +304,14 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartEventLoopTask()
 
     pthread_mutex_unlock(&mStateLock);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (err == 0)
+    {
+        // If the background tasks fail to start, background events are processed by the CHIP task.
+        LogErrorOnFailure(Impl()->StartBackgroundEventLoopTask());
+    }
+#endif
+
     return CHIP_ERROR_POSIX(err);
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
@@ -330,6 +339,14 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopEventLoopTask()
 
     int err = 0;
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    //
+    // Let the background tasks finish the pending background work before the runloop stops, so that the work
+    // it schedules back on the CHIP task is not left behind.
+    //
+    LogErrorOnFailure(Impl()->StopBackgroundEventLoopTask());
+#endif
+
     //
     // Signal to the runloop to stop.
     //
@@ -383,6 +400,123 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventQueueLock);
+        if (mShouldRunBackgroundEventLoop)
+        {
+            if (mBackgroundEventQueue.size() >= CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE)
+            {
+                ChipLogError(DeviceLayer, "Failed to post event to CHIP background event queue");
+                return CHIP_ERROR_NO_MEMORY;
+            }
+            mBackgroundEventQueue.push(*event);
+            mBackgroundEventQueueCond.notify_one();
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // Use foreground event loop for background events while no background task is running
+    return _PostEvent(event);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventQueueLock);
+        mShouldRunBackgroundEventLoop = true;
+    }
+    ProcessBackgroundEvents();
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessBackgroundEvents()
+{
+    std::unique_lock<std::mutex> lock(mBackgroundEventQueueLock);
+    while (true)
+    {
+        mBackgroundEventQueueCond.wait(lock, [this] { return !mBackgroundEventQueue.empty() || !mShouldRunBackgroundEventLoop; });
+
+        // Once stopped, keep going until the pending events are processed.
+        if (mBackgroundEventQueue.empty())
+        {
+            break;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        lock.unlock();
+        Impl()->DispatchEvent(&event);
+        lock.lock();
+    }
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    std::lock_guard<std::mutex> lock(mBackgroundEventQueueLock);
+    VerifyOrReturnError(mBackgroundEventLoopTaskCount == 0, CHIP_NO_ERROR);
+
+    int err                       = 0;
+    mShouldRunBackgroundEventLoop = true;
+    while (mBackgroundEventLoopTaskCount < CHIP_DEVICE_CONFIG_BG_TASK_COUNT)
+    {
+        err = pthread_create(&mBackgroundEventLoopTasks[mBackgroundEventLoopTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        VerifyOrExit(err == 0, );
+        mBackgroundEventLoopTaskCount++;
+    }
+
+exit:
+    // The tasks started so far keep processing background events; without any, they go to the CHIP task.
+    mShouldRunBackgroundEventLoop = (mBackgroundEventLoopTaskCount > 0);
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    pthread_t tasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t taskCount;
+
+    {
+        std::lock_guard<std::mutex> lock(mBackgroundEventQueueLock);
+        mShouldRunBackgroundEventLoop = false;
+        taskCount                     = mBackgroundEventLoopTaskCount;
+        mBackgroundEventLoopTaskCount = 0;
+        std::copy(mBackgroundEventLoopTasks, mBackgroundEventLoopTasks + taskCount, tasks);
+    }
+    mBackgroundEventQueueCond.notify_all();
+
+    int err = 0;
+    for (size_t i = 0; i < taskCount; i++)
+    {
+        // A background task can not wait for itself to terminate.
+        int joinErr = pthread_equal(pthread_self(), tasks[i]) ? pthread_detach(tasks[i]) : pthread_join(tasks[i], nullptr);
+        if (joinErr != 0)
+        {
+            err = joinErr;
+        }
+    }
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->ProcessBackgroundEvents();
+    return nullptr;
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -393,6 +527,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // The background tasks may have been started by the application rather than by StartEventLoopTask().
+    LogErrorOnFailure(Impl()->StopBackgroundEventLoopTask());
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
@@ -272,6 +272,43 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams the socket-based implementation of UDP
+ *    endpoints receives per read notification.
+ *
+ *  @details
+ *    When this is greater than 1, the UDP endpoint drains up to this many
+ *    datagrams with a single recvmmsg() call into packet buffers that are
+ *    kept allocated between notifications, instead of calling recvmsg()
+ *    once per notification. The platform must provide recvmmsg().
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+ *
+ *  @brief
+ *    Maximum number of queued buffers the socket-based implementation of TCP
+ *    endpoints hands to the operating system per system call.
+ *
+ *  @details
+ *    When this is greater than 1, the TCP endpoint coalesces up to this many
+ *    buffers of its send queue into a single sendmsg() call, instead of
+ *    calling send() once per buffer. This must not exceed IOV_MAX.
+ */
+#ifndef INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+#ifndef __ZEPHYR__
+#define INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT 8
+#else
+#define INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT 1
+#endif
+#endif // INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
@@ -286,6 +286,18 @@ public:
      */
     CHIP_ERROR SetReceivedDataForTesting(chip::System::PacketBufferHandle && data);
 
+    /**
+     * @brief   Limit the number of bytes handed to the network stack per write, for testing.
+     *
+     * @param[in]   maxLength   Maximum number of bytes per write, or 0 for no limit.
+     *
+     * @details
+     *  Makes the endpoint split its send queue into partial writes, so that unit
+     *  tests can exercise how partially sent buffers are resumed. Only the
+     *  sockets implementation honors this.
+     */
+    void SetMaxSendLengthForTesting(size_t maxLength) { mMaxSendLengthForTesting = maxLength; }
+
     /**
      * @brief   Extract the length of the data awaiting first transmit.
      *
@@ -564,6 +576,7 @@ protected:
 
     chip::System::PacketBufferHandle mRcvQueue;
     chip::System::PacketBufferHandle mSendQueue;
+    size_t mMaxSendLengthForTesting = 0; // See SetMaxSendLengthForTesting(); zero means no limit.
 #if INET_TCP_IDLE_CHECK_INTERVAL > 0
     static void HandleIdleTimer(System::Layer * aSystemLayer, void * aAppState);
     static bool IsIdleTimerRunning(EndPointManager<TCPEndPoint> & endPointManager);
@@ -30,12 +30,14 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemFaultInjection.h>
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <utility>
 
 #include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <net/if.h>
 #include <netinet/tcp.h>
 #include <sys/ioctl.h>
@@ -64,6 +66,10 @@
 #define TCP_IDLE_INTERVAL_OPT_NAME TCP_KEEPALIVE
 #endif
 
+#if INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT > 1 && defined(IOV_MAX)
+static_assert(INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT <= IOV_MAX, "sendmsg() accepts at most IOV_MAX buffers");
+#endif
+
 namespace chip {
 namespace Inet {
 
@@ -483,9 +489,47 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
+#if INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT > 1
+        // Hand the head of the send queue to a single sendmsg() call, so that back to back
+        // messages do not each cost a system call.
+        struct iovec msgIOVs[INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < ArraySize(msgIOVs); buf.Advance())
+        {
+            size_t iovLen = buf->DataLength();
+            if (mMaxSendLengthForTesting != 0)
+            {
+                iovLen = std::min(iovLen, mMaxSendLengthForTesting - bufLen);
+            }
+
+            msgIOVs[iovCount].iov_base = buf->Start();
+            msgIOVs[iovCount].iov_len  = iovLen;
+            bufLen += iovLen;
+            iovCount++;
+
+            if (mMaxSendLengthForTesting != 0 && bufLen == mMaxSendLengthForTesting)
+            {
+                break;
+            }
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = msgIOVs;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
+#else
         size_t bufLen = mSendQueue->DataLength();
+        if (mMaxSendLengthForTesting != 0)
+        {
+            bufLen = std::min(bufLen, mMaxSendLengthForTesting);
+        }
 
         ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+#endif // INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT > 1
 
         if (lenSentRaw == -1)
         {
@@ -507,21 +551,37 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+#if INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT > 1
+        // Free the buffers that were sent entirely, and consume what was sent of the next one.
+        size_t lenRemaining = lenSent;
+        for (size_t i = 0; i < iovCount; i++)
+        {
+            if (lenRemaining < mSendQueue->DataLength())
+            {
+                mSendQueue->ConsumeHead(lenRemaining);
+                break;
+            }
+            lenRemaining -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
+        }
+#else
+        if (lenSent < mSendQueue->DataLength())
         {
             mSendQueue->ConsumeHead(lenSent);
         }
         else
         {
             mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+        }
+#endif // INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT > 1
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -57,10 +57,18 @@ private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    void ReceiveBatch();
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    // Receive buffers for recvmmsg(). Buffers that are not filled by one batch are kept for the next one.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE];
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
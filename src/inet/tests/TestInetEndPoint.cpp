@@ -364,6 +364,69 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(System::Stats::kInetLayer_NumTCPEps, 1));
 }
 
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+// Test that a burst of datagrams queued on a UDP socket is delivered in full and in order, with
+// each datagram carrying its own packet info.
+TEST_F(TestInetEndPoint, TestInetUDPReceiveBurst)
+{
+    struct ReceiveState
+    {
+        uint16_t senderPort;
+        uint8_t received;
+        bool inOrder;
+        bool packetInfoValid;
+    };
+
+    constexpr uint8_t kDatagramCount = 3 * INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE + 1;
+
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    ReceiveState state     = { 0, 0, true, true };
+    IPAddress loopback     = IPAddress::Loopback(IPAddressType::kIPv6);
+
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    state.senderPort = sender->GetBoundPort();
+
+    auto onMessageReceived = [](UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo) {
+        auto * receiveState = static_cast<ReceiveState *>(endPoint->mAppState);
+        if (msg->DataLength() != 1 || msg->Start()[0] != receiveState->received)
+        {
+            receiveState->inOrder = false;
+        }
+        if (pktInfo->SrcPort != receiveState->senderPort || pktInfo->DestPort != endPoint->GetBoundPort())
+        {
+            receiveState->packetInfoValid = false;
+        }
+        receiveState->received++;
+    };
+    ASSERT_EQ(receiver->Listen(onMessageReceived, nullptr, &state), CHIP_NO_ERROR);
+
+    // Queue all datagrams before servicing the receiver, so they are pending on its socket together.
+    for (uint8_t i = 0; i < kDatagramCount; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::NewWithData(&i, sizeof(i));
+        ASSERT_FALSE(buf.IsNull());
+        EXPECT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+    }
+
+    for (int i = 0; i < 100 && state.received < kDatagramCount; i++)
+    {
+        ServiceEvents(10);
+    }
+
+    EXPECT_EQ(state.received, kDatagramCount);
+    EXPECT_TRUE(state.inOrder);
+    EXPECT_TRUE(state.packetInfoValid);
+
+    sender->Free();
+    receiver->Free();
+}
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
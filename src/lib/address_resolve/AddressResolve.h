@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/IntrusiveList.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -247,6 +248,14 @@ public:
     /// any new lookups until re-initialized.
     virtual void Shutdown() = 0;
 
+    /// Provides storage the resolver may use to remember node addresses
+    /// across restarts. Optional: implementations that keep no such state
+    /// ignore it.
+    ///
+    /// The storage is used until the next Shutdown(), which is also when
+    /// any pending state is written out.
+    virtual void SetPersistentStorage(PersistentStorageDelegate * storage) {}
+
     /// Expected to be provided by the implementation.
     static Resolver & Instance();
 };
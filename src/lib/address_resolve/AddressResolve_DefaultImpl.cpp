@@ -18,6 +18,11 @@
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 
 #include <lib/address_resolve/TracingStructs.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <tracing/macros.h>
 
 namespace chip {
@@ -27,6 +32,22 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+// Tags of the fields of a persisted cache entry.
+constexpr TLV::Tag kCompressedFabricIdTag   = TLV::ContextTag(1);
+constexpr TLV::Tag kNodeIdTag               = TLV::ContextTag(2);
+constexpr TLV::Tag kIPAddressTag            = TLV::ContextTag(3);
+constexpr TLV::Tag kPortTag                 = TLV::ContextTag(4);
+constexpr TLV::Tag kIdleRetransTimeoutTag   = TLV::ContextTag(5);
+constexpr TLV::Tag kActiveRetransTimeoutTag = TLV::ContextTag(6);
+constexpr TLV::Tag kActiveThresholdTimeTag  = TLV::ContextTag(7);
+constexpr TLV::Tag kFlagsTag                = TLV::ContextTag(8);
+
+constexpr uint8_t kSupportsTcpServerFlag   = 0x01;
+constexpr uint8_t kSupportsTcpClientFlag   = 0x02;
+constexpr uint8_t kIsICDOperatingAsLITFlag = 0x04;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -34,6 +55,16 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mServedFromCache  = false;
+}
+
+void NodeLookupHandle::ResetForCachedResult(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                                            const ResolveResult & result)
+{
+    ResetForLookup(now, request);
+    mResults.results[0] = result;
+    mResults.count      = 1;
+    mServedFromCache    = true;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -65,7 +96,7 @@ System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timesta
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
-    if (elapsed < mRequest.GetMinLookupTime())
+    if (elapsed < mRequest.GetMinLookupTime() && !mServedFromCache)
     {
         return mRequest.GetMinLookupTime() - elapsed;
     }
@@ -104,7 +135,8 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
     // We are still within the minimal search time. Wait for more results.
-    if (elapsed < mRequest.GetMinLookupTime())
+    // A cached result is not competing with any, so it needs no wait.
+    if (elapsed < mRequest.GetMinLookupTime() && !mServedFromCache)
     {
         ChipLogProgress(Discovery, "Keeping DNSSD lookup active");
         return NodeLookupAction::KeepSearching();
@@ -189,6 +221,35 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    auto & peerId                      = request.GetPeerId();
+
+    ResolveResult cachedResult;
+    NodeAddressCache::Freshness freshness;
+    if (mCache.Lookup(peerId, now, cachedResult, freshness))
+    {
+        // Hand out the cached address right away (from the timer, so the
+        // listener is still called asynchronously) and confirm it in the
+        // background if it is getting old.
+        handle.ResetForCachedResult(now, request, cachedResult);
+        mActiveLookups.PushBack(&handle);
+        if (freshness == NodeAddressCache::Freshness::kStale)
+        {
+            StartCacheRefresh(peerId);
+        }
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup for " ChipLogFormatPeerId " served from cache (%s)", ChipLogValuePeerId(peerId),
+                        freshness == NodeAddressCache::Freshness::kFresh ? "fresh" : "stale");
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+    return StartDnssdLookup(request, handle);
+}
+
+CHIP_ERROR Resolver::StartDnssdLookup(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle)
+{
     handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
     auto & peerId = request.GetPeerId();
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
@@ -198,9 +259,31 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
     return CHIP_NO_ERROR;
 }
 
+void Resolver::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
+{
+    for (auto & activeLookup : mActiveLookups)
+    {
+        if (activeLookup.GetRequest().GetPeerId() == peerId)
+        {
+            return;
+        }
+    }
+    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+}
+
 CHIP_ERROR Resolver::TryNextResult(Impl::NodeLookupHandle & handle)
 {
     VerifyOrReturnError(!mActiveLookups.Contains(&handle), CHIP_ERROR_INCORRECT_STATE);
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    // The caller could not use the address it was given (e.g. CASE timed
+    // out): make sure the next lookup does not hand it out again.
+    if (mCache.Evict(handle.GetRequest().GetPeerId()))
+    {
+        ScheduleCacheSave();
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     VerifyOrReturnError(handle.HasLookupResult(), CHIP_ERROR_NOT_FOUND);
 
     auto listener = handle.GetListener();
@@ -217,7 +300,7 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -270,10 +353,34 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    if (mSystemLayer->IsTimerActive(&OnCacheSaveTimer, static_cast<void *>(this)))
+    {
+        mSystemLayer->CancelTimer(&OnCacheSaveTimer, static_cast<void *>(this));
+        SaveCache();
+    }
+    mCacheStorage = nullptr;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
+void Resolver::SetPersistentStorage(PersistentStorageDelegate * storage)
+{
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    mCacheStorage = storage;
+    VerifyOrReturn(mCacheStorage != nullptr);
+
+    CHIP_ERROR err = mCache.Load(*mCacheStorage, mTimeSource.GetMonotonicTimestamp());
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(Discovery, "Failed to load the address cache: %" CHIP_ERROR_FORMAT, err.Format());
+        mCache.Clear();
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+}
+
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
     auto it = mActiveLookups.begin();
@@ -331,9 +438,20 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     // final result, handle either success or failure
     const PeerId peerId     = current->GetRequest().GetPeerId();
     NodeListener * listener = current->GetListener();
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    const bool servedFromCache = current->IsServedFromCache();
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    NodeIdResolutionNoLongerNeeded(peerId);
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    if (action.Type() == NodeLookupResult::kLookupSuccess && !servedFromCache)
+    {
+        mCache.Store(peerId, action.ResolveResult(), mTimeSource.GetMonotonicTimestamp());
+        ScheduleCacheSave();
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -440,6 +558,267 @@ void Resolver::ReArmTimer()
     }
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+void Resolver::StartCacheRefresh(const PeerId & peerId)
+{
+    CacheRefresh * freeRefresh = nullptr;
+    for (auto & refresh : mCacheRefreshes)
+    {
+        if (!refresh.mHandle.IsActive())
+        {
+            freeRefresh = (freeRefresh == nullptr) ? &refresh : freeRefresh;
+        }
+        else if (refresh.mHandle.GetRequest().GetPeerId() == peerId)
+        {
+            // Already being confirmed.
+            return;
+        }
+    }
+
+    if (freeRefresh == nullptr)
+    {
+        ChipLogDetail(Discovery, "No room to refresh the cached address of " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
+        return;
+    }
+
+    CHIP_ERROR err = StartDnssdLookup(NodeLookupRequest(peerId), freeRefresh->mHandle);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to refresh the cached address of " ChipLogFormatPeerId ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValuePeerId(peerId), err.Format());
+    }
+}
+
+void Resolver::ScheduleCacheSave()
+{
+    VerifyOrReturn(mCacheStorage != nullptr && mSystemLayer != nullptr);
+    VerifyOrReturn(!mSystemLayer->IsTimerActive(&OnCacheSaveTimer, static_cast<void *>(this)));
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(kCacheSaveDelay, &OnCacheSaveTimer, static_cast<void *>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        SaveCache();
+    }
+}
+
+void Resolver::SaveCache()
+{
+    VerifyOrReturn(mCacheStorage != nullptr);
+
+    CHIP_ERROR err = mCache.Save(*mCacheStorage);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to save the address cache: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+NodeAddressCache::Entry * NodeAddressCache::Find(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+bool NodeAddressCache::Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result, Freshness & freshness)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    if (now >= entry->staleUntil)
+    {
+        entry->inUse = false;
+        return false;
+    }
+
+    result    = entry->result;
+    freshness = (now < entry->freshUntil) ? Freshness::kFresh : Freshness::kStale;
+    return true;
+}
+
+void NodeAddressCache::Store(const PeerId & peerId, const ResolveResult & result, System::Clock::Timestamp now)
+{
+    Entry * entry = Find(peerId);
+    if (entry == nullptr)
+    {
+        // Take a free entry, or else the one closest to expiring.
+        entry = &mEntries[0];
+        for (auto & candidate : mEntries)
+        {
+            if (!candidate.inUse)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (candidate.staleUntil < entry->staleUntil)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->peerId     = peerId;
+    entry->result     = result;
+    entry->freshUntil = now + kFreshTime;
+    entry->staleUntil = entry->freshUntil + kStaleTime;
+    entry->inUse      = true;
+}
+
+bool NodeAddressCache::Evict(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr, false);
+    entry->inUse = false;
+    return true;
+}
+
+void NodeAddressCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.inUse = false;
+    }
+}
+
+CHIP_ERROR NodeAddressCache::Save(PersistentStorageDelegate & storage) const
+{
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(kMaxEncodedSize);
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), kMaxEncodedSize);
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+    for (const auto & entry : mEntries)
+    {
+        // Interfaces are not meaningful across restarts, and only link-local
+        // addresses (which need one) keep theirs.
+        if (!entry.inUse || entry.result.address.GetInterface() != Inet::InterfaceId::Null())
+        {
+            continue;
+        }
+
+        uint8_t ipAddress[sizeof(Inet::IPAddress::Addr)];
+        uint8_t * p = ipAddress;
+        entry.result.address.GetIPAddress().WriteAddress(p);
+
+        const auto & mrpConfig = entry.result.mrpRemoteConfig;
+        uint8_t flags          = 0;
+        flags |= entry.result.supportsTcpServer ? kSupportsTcpServerFlag : 0;
+        flags |= entry.result.supportsTcpClient ? kSupportsTcpClientFlag : 0;
+        flags |= entry.result.isICDOperatingAsLIT ? kIsICDOperatingAsLITFlag : 0;
+
+        TLV::TLVType structType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+        ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, entry.peerId.GetCompressedFabricId()));
+        ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+        ReturnErrorOnFailure(writer.Put(kIPAddressTag, ByteSpan(ipAddress)));
+        ReturnErrorOnFailure(writer.Put(kPortTag, entry.result.address.GetPort()));
+        ReturnErrorOnFailure(writer.Put(kIdleRetransTimeoutTag, mrpConfig.mIdleRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kActiveRetransTimeoutTag, mrpConfig.mActiveRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kActiveThresholdTimeTag, mrpConfig.mActiveThresholdTime.count()));
+        ReturnErrorOnFailure(writer.Put(kFlagsTag, flags));
+        ReturnErrorOnFailure(writer.EndContainer(structType));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    writer.Finalize(backingBuffer);
+
+    return storage.SyncSetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), backingBuffer.Get(),
+                                   static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR NodeAddressCache::Load(PersistentStorageDelegate & storage, System::Clock::Timestamp now)
+{
+    Clear();
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    backingBuffer.Calloc(kMaxEncodedSize);
+    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len = static_cast<uint16_t>(kMaxEncodedSize);
+    ReturnErrorOnFailure(
+        storage.SyncGetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), backingBuffer.Get(), len));
+
+    TLV::ScopedBufferTLVReader reader(std::move(backingBuffer), len);
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    size_t count = 0;
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR && count < CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE)
+    {
+        Entry & entry = mEntries[count];
+
+        CompressedFabricId compressedFabricId;
+        NodeId nodeId;
+        ByteSpan ipAddress;
+        uint16_t port;
+        uint32_t idleRetransTimeout;
+        uint32_t activeRetransTimeout;
+        uint16_t activeThresholdTime;
+        uint8_t flags;
+
+        TLV::TLVType structType;
+        ReturnErrorOnFailure(reader.EnterContainer(structType));
+        ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(compressedFabricId));
+        ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(nodeId));
+        ReturnErrorOnFailure(reader.Next(kIPAddressTag));
+        ReturnErrorOnFailure(reader.Get(ipAddress));
+        VerifyOrReturnError(ipAddress.size() == sizeof(Inet::IPAddress::Addr), CHIP_ERROR_INVALID_TLV_ELEMENT);
+        ReturnErrorOnFailure(reader.Next(kPortTag));
+        ReturnErrorOnFailure(reader.Get(port));
+        ReturnErrorOnFailure(reader.Next(kIdleRetransTimeoutTag));
+        ReturnErrorOnFailure(reader.Get(idleRetransTimeout));
+        ReturnErrorOnFailure(reader.Next(kActiveRetransTimeoutTag));
+        ReturnErrorOnFailure(reader.Get(activeRetransTimeout));
+        ReturnErrorOnFailure(reader.Next(kActiveThresholdTimeTag));
+        ReturnErrorOnFailure(reader.Get(activeThresholdTime));
+        ReturnErrorOnFailure(reader.Next(kFlagsTag));
+        ReturnErrorOnFailure(reader.Get(flags));
+        ReturnErrorOnFailure(reader.ExitContainer(structType));
+
+        Inet::IPAddress address;
+        const uint8_t * p = ipAddress.data();
+        Inet::IPAddress::ReadAddress(p, address);
+
+        entry.peerId = PeerId(compressedFabricId, nodeId);
+        entry.result.address.SetIPAddress(address);
+        entry.result.address.SetPort(port);
+        entry.result.address.SetInterface(Inet::InterfaceId::Null());
+        entry.result.mrpRemoteConfig = ReliableMessageProtocolConfig(System::Clock::Milliseconds32(idleRetransTimeout),
+                                                                     System::Clock::Milliseconds32(activeRetransTimeout),
+                                                                     System::Clock::Milliseconds16(activeThresholdTime));
+        entry.result.supportsTcpServer   = (flags & kSupportsTcpServerFlag) != 0;
+        entry.result.supportsTcpClient   = (flags & kSupportsTcpClientFlag) != 0;
+        entry.result.isICDOperatingAsLIT = (flags & kIsICDOperatingAsLITFlag) != 0;
+
+        // How long ago these were resolved is unknown: use them, but confirm them.
+        entry.freshUntil = now;
+        entry.staleUntil = now + kStaleTime;
+        entry.inUse      = true;
+        count++;
+    }
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
+    return CHIP_NO_ERROR;
+}
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 } // namespace Impl
 
 Resolver & Resolver::Instance()
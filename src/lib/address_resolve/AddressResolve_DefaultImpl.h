@@ -17,6 +17,8 @@
 #pragma once
 
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/TLVCommon.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
 #include <system/TimeSource.h>
@@ -157,12 +159,88 @@ public:
     /// be triggered for this lookup handle
     System::Clock::Timeout NextEventTimeout(System::Clock::Timestamp now);
 
+    /// Sets up a request answered by a previously cached result: the result
+    /// is handed out as soon as possible, without waiting for the min lookup
+    /// time.
+    void ResetForCachedResult(System::Clock::Timestamp now, const NodeLookupRequest & request, const ResolveResult & result);
+
+    /// Was the current request answered from the cache?
+    bool IsServedFromCache() const { return mServedFromCache; }
+
 private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mServedFromCache = false;
 };
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+/// Remembers the addresses that operational lookups resolved to, keyed by
+/// PeerId, so that looking up a node again does not have to wait for DNS-SD.
+///
+/// An entry is fresh for kFreshTime after its address was resolved. It then
+/// remains usable, but stale, for kStaleTime: stale entries are meant to be
+/// confirmed by a new lookup while they are being used. Entries loaded from
+/// storage start out stale, since how old they are is unknown.
+///
+/// When full, storing a new entry replaces the one closest to expiring.
+class NodeAddressCache
+{
+public:
+    enum class Freshness : uint8_t
+    {
+        kFresh,
+        kStale,
+    };
+
+    static constexpr System::Clock::Seconds32 kFreshTime{ CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_FRESH_TIME_SECS };
+    static constexpr System::Clock::Seconds32 kStaleTime{ CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_STALE_TIME_SECS };
+
+    /// Looks up the address of a node, dropping its entry if it has expired.
+    ///
+    /// Returns false if there is no usable entry, otherwise fills in
+    /// `result` and `freshness`.
+    bool Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result, Freshness & freshness);
+
+    /// Remembers the address a node was just resolved to.
+    void Store(const PeerId & peerId, const ResolveResult & result, System::Clock::Timestamp now);
+
+    /// Forgets the address of a node. Returns whether there was one.
+    bool Evict(const PeerId & peerId);
+
+    void Clear();
+
+    /// Writes the cached entries to storage, as a single value.
+    CHIP_ERROR Save(PersistentStorageDelegate & storage) const;
+
+    /// Replaces the cached entries with the ones last saved to storage.
+    CHIP_ERROR Load(PersistentStorageDelegate & storage, System::Clock::Timestamp now);
+
+private:
+    struct Entry
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Timestamp freshUntil;
+        System::Clock::Timestamp staleUntil;
+        bool inUse = false;
+    };
+
+    static constexpr size_t kMaxEntryEncodedSize =
+        TLV::EstimateStructOverhead(sizeof(CompressedFabricId), sizeof(NodeId), sizeof(Inet::IPAddress::Addr), sizeof(uint16_t),
+                                    sizeof(uint32_t), sizeof(uint32_t), sizeof(uint16_t), sizeof(uint8_t));
+    static constexpr size_t kMaxEncodedSize =
+        TLV::EstimateStructOverhead() + CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE * kMaxEntryEncodedSize;
+    static_assert(kMaxEncodedSize <= UINT16_MAX, "The cache must fit in a single storage value");
+
+    Entry * Find(const PeerId & peerId);
+
+    Entry mEntries[CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE];
+};
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
 {
 public:
@@ -175,6 +253,7 @@ public:
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
     void Shutdown() override;
+    void SetPersistentStorage(PersistentStorageDelegate * storage) override;
 
     // Dnssd::OperationalResolveDelegate
 
@@ -200,6 +279,45 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Starts the DNS-SD resolution backing a lookup.
+    CHIP_ERROR StartDnssdLookup(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle);
+
+    /// Tells DNS-SD that a node no longer needs resolving, unless another
+    /// active lookup (e.g. a cache refresh) still needs it.
+    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId);
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    /// Background lookup confirming a stale cached address. Whatever it
+    /// resolves to updates the cache like any other lookup.
+    class CacheRefresh : public NodeListener
+    {
+    public:
+        CacheRefresh() { mHandle.SetListener(this); }
+
+        void OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result) override {}
+        void OnNodeAddressResolutionFailed(const PeerId & peerId, CHIP_ERROR reason) override {}
+
+        NodeLookupHandle mHandle;
+    };
+
+    static constexpr System::Clock::Timeout kCacheSaveDelay = System::Clock::Seconds16(10);
+
+    static void OnCacheSaveTimer(System::Layer * layer, void * context) { static_cast<Resolver *>(context)->SaveCache(); }
+
+    /// Starts confirming the cached address of a node, unless that is already
+    /// in progress or too many confirmations are.
+    void StartCacheRefresh(const PeerId & peerId);
+
+    /// Writes the cache to storage a little later, so that bursts of updates
+    /// only cost one write.
+    void ScheduleCacheSave();
+    void SaveCache();
+
+    NodeAddressCache mCache;
+    CacheRefresh mCacheRefreshes[CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_REFRESHES];
+    PersistentStorageDelegate * mCacheStorage = nullptr;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
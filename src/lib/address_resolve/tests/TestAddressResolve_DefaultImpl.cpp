@@ -18,6 +18,8 @@
 
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 
 using namespace chip;
 using namespace chip::AddressResolve;
@@ -199,4 +201,147 @@ TEST(TestAddressResolveDefaultImpl, TestLookupResult)
     // Check that the results has been consumed properly.
     EXPECT_FALSE(handle.HasLookupResult());
 }
+
+TEST(TestAddressResolveDefaultImpl, TestCachedResultSkipsMinLookupTime)
+{
+    ResolveResult cachedResult;
+    cachedResult.address = GetAddressWithMediumScore();
+
+    AddressResolve::NodeLookupHandle handle;
+
+    auto now     = System::SystemClock().GetMonotonicTimestamp();
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    handle.ResetForCachedResult(now, request, cachedResult);
+
+    EXPECT_TRUE(handle.IsServedFromCache());
+    EXPECT_EQ(handle.NextEventTimeout(now), System::Clock::Timeout::zero());
+
+    auto action = handle.NextAction(now);
+    ASSERT_EQ(action.Type(), Impl::NodeLookupResult::kLookupSuccess);
+    EXPECT_EQ(action.ResolveResult().address, cachedResult.address);
+
+    handle.ResetForLookup(now, request);
+    EXPECT_FALSE(handle.IsServedFromCache());
+}
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+class TestNodeAddressCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+using Impl::NodeAddressCache;
+
+TEST_F(TestNodeAddressCache, TestFreshThenStaleThenExpired)
+{
+    NodeAddressCache cache;
+    const PeerId peerId(1, 2);
+    const System::Clock::Timestamp start = System::Clock::Seconds64(1000);
+
+    ResolveResult stored;
+    stored.address = GetAddressWithMediumScore(5541);
+
+    ResolveResult result;
+    NodeAddressCache::Freshness freshness;
+    EXPECT_FALSE(cache.Lookup(peerId, start, result, freshness));
+
+    cache.Store(peerId, stored, start);
+
+    EXPECT_TRUE(cache.Lookup(peerId, start, result, freshness));
+    EXPECT_EQ(freshness, NodeAddressCache::Freshness::kFresh);
+    EXPECT_EQ(result.address, stored.address);
+
+    EXPECT_TRUE(cache.Lookup(peerId, start + NodeAddressCache::kFreshTime, result, freshness));
+    EXPECT_EQ(freshness, NodeAddressCache::Freshness::kStale);
+    EXPECT_EQ(result.address, stored.address);
+
+    EXPECT_FALSE(cache.Lookup(peerId, start + NodeAddressCache::kFreshTime + NodeAddressCache::kStaleTime, result, freshness));
+
+    // Expired entries are dropped.
+    EXPECT_FALSE(cache.Lookup(peerId, start, result, freshness));
+}
+
+TEST_F(TestNodeAddressCache, TestEvict)
+{
+    NodeAddressCache cache;
+    const PeerId peerId(1, 2);
+    const System::Clock::Timestamp now = System::Clock::Seconds64(1000);
+
+    ResolveResult stored;
+    stored.address = GetAddressWithLowScore();
+    cache.Store(peerId, stored, now);
+    cache.Store(PeerId(1, 3), stored, now);
+
+    EXPECT_TRUE(cache.Evict(peerId));
+    EXPECT_FALSE(cache.Evict(peerId));
+
+    ResolveResult result;
+    NodeAddressCache::Freshness freshness;
+    EXPECT_FALSE(cache.Lookup(peerId, now, result, freshness));
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 3), now, result, freshness));
+}
+
+TEST_F(TestNodeAddressCache, TestFullCacheReplacesOldest)
+{
+    NodeAddressCache cache;
+    const System::Clock::Timestamp start = System::Clock::Seconds64(1000);
+
+    ResolveResult stored;
+    stored.address = GetAddressWithLowScore();
+
+    for (NodeId nodeId = 1; nodeId <= CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE; nodeId++)
+    {
+        cache.Store(PeerId(1, nodeId), stored, start + System::Clock::Seconds64(nodeId));
+    }
+    cache.Store(PeerId(1, CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE + 1), stored, start + System::Clock::Seconds64(1000));
+
+    ResolveResult result;
+    NodeAddressCache::Freshness freshness;
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 1), start, result, freshness));
+    EXPECT_TRUE(cache.Lookup(PeerId(1, CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE + 1), start, result, freshness));
+    if (CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 1)
+    {
+        EXPECT_TRUE(cache.Lookup(PeerId(1, 2), start, result, freshness));
+    }
+}
+
+TEST_F(TestNodeAddressCache, TestSaveAndLoad)
+{
+    TestPersistentStorageDelegate storage;
+    const System::Clock::Timestamp now = System::Clock::Seconds64(1000);
+
+    ResolveResult stored;
+    stored.address             = GetAddressWithMediumScore(5541);
+    stored.mrpRemoteConfig     = ReliableMessageProtocolConfig(System::Clock::Milliseconds32(1200),
+                                                               System::Clock::Milliseconds32(300),
+                                                               System::Clock::Milliseconds16(4000));
+    stored.supportsTcpServer   = true;
+    stored.isICDOperatingAsLIT = true;
+
+    {
+        NodeAddressCache cache;
+        cache.Store(PeerId(1, 2), stored, now);
+        EXPECT_EQ(cache.Save(storage), CHIP_NO_ERROR);
+    }
+
+    NodeAddressCache cache;
+    const System::Clock::Timestamp later = System::Clock::Seconds64(10);
+    EXPECT_EQ(cache.Load(storage, later), CHIP_NO_ERROR);
+
+    ResolveResult result;
+    NodeAddressCache::Freshness freshness;
+    ASSERT_TRUE(cache.Lookup(PeerId(1, 2), later, result, freshness));
+    EXPECT_EQ(freshness, NodeAddressCache::Freshness::kStale);
+    EXPECT_EQ(result.address, stored.address);
+    EXPECT_EQ(result.mrpRemoteConfig, stored.mrpRemoteConfig);
+    EXPECT_TRUE(result.supportsTcpServer);
+    EXPECT_FALSE(result.supportsTcpClient);
+    EXPECT_TRUE(result.isICDOperatingAsLIT);
+}
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 } // namespace
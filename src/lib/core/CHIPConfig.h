@@ -769,6 +769,22 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+ *
+ * @brief Enables hash indexes over the secure and unauthenticated session
+ * tables, so that looking up a session by local session ID or by peer does not
+ * scan the whole table.
+ *
+ * The indexes are allocated from the heap and grow with the number of sessions,
+ * so they are only enabled by default when pools are heap allocated (where
+ * the tables are typically large). Small, statically sized tables are faster to
+ * scan than to index.
+ */
+#ifndef CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+#define CHIP_CONFIG_SESSION_TABLE_HASH_INDEX CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -959,6 +975,35 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_TIMED_HANDLER 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE
+ *
+ * @brief The size, in bytes, of the blocks a ClusterStateCache allocates to hold the attribute values it caches.
+ *        Values larger than a block get a block of their own.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_DATA_BLOCK_SIZE 2048
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE
+ *
+ * @brief The size, in bytes, of the arena each ReadHandler embeds to hold its attribute path, event path and
+ *        data version filter lists. Lists that outgrow it continue in heap chunks of the same size, and all
+ *        of it is released at once when the ReadHandler goes away.
+ *
+ *        Setting this to 0 takes the list nodes from the pools shared by the InteractionModelEngine
+ *        instead. This is the default when pools are statically allocated, since those pools already
+ *        bound the number of paths and an arena in every ReadHandler would only add to the RAM they use.
+ */
+#ifndef CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE 256
+#else
+#define CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_IM_SERVER_PATH_LIST_ARENA_SIZE
+
 /**
  * @}
  */
@@ -1107,6 +1152,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE
+ *
+ * @brief Enables the in-memory index of group sessions kept by GroupDataProviderImpl
+ *
+ * When enabled, the operational and privacy keys of all the group sessions are loaded from storage once, and kept in a heap
+ * allocated table sorted by session id, so that looking up the sessions of an incoming group message does not read the
+ * storage nor derive any key. The table is dropped whenever the group keys or key sets are modified, and loaded again on the
+ * next lookup.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE 1
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1116,6 +1175,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Defines the number of recent access control decisions (subject, endpoint, cluster
+ * and privilege) remembered by AccessControl::Check, so that checking the many paths of
+ * a wildcard interaction does not walk the access control list for each of them.
+ *
+ * The cache is cleared on any change to the access control list. 0 disables it.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1236,6 +1308,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief
+ *   The number of event positions remembered by each event buffer, spread evenly over the buffer.
+ *
+ * When fetching the events a subscriber has not seen yet, reading starts from the last remembered position before the
+ * first unseen event instead of the oldest event, so that the events the subscriber already got are mostly not parsed
+ * again. A value of 0 disables the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 8
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1359,6 +1445,75 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+ *
+ * @brief Enables usage of heap in the minmdns DNSSD implementation
+ *        for tracking pending resolve and browse queries.
+ *
+ *        When set, the table of pending queries grows on demand up to
+ *        CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS entries. When not set,
+ *        only 4 queries are tracked and older ones are dropped to make room
+ *        for new ones.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+#define CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS 0
+#endif // CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS
+ *
+ * @brief Maximum number of pending resolve and browse queries tracked by minmdns
+ *        when CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS is set.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS
+#define CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS 64
+#endif // CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+ *
+ * @brief Number of PTR records minmdns remembers while browsing, to list them
+ *        as known answers in browse retries (RFC 6762 section 7.1) so that
+ *        nodes that were already discovered do not answer again.
+ *        0 disables known answer suppression.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS 16
+#else
+#define CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of serialized query replies the minmdns advertiser keeps,
+ *        keyed by query name, type, class and receiving interface, so that
+ *        repeated queries are answered without re-building the reply.
+ *        The cache is dropped whenever the advertised services change.
+ *        0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 8
+#else
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS
+ *
+ * @brief Time after which a cached minmdns reply is built again. This bounds
+ *        how long address records stay stale after interface addresses change,
+ *        as those changes do not invalidate the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS 10
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1370,6 +1525,54 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS 1
 #endif // CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of operational node addresses the default address resolver remembers, so that
+ *        looking a node up again does not have to wait for DNS-SD. 0 disables the cache.
+ *
+ *        Enabled by default only when pools are heap allocated: small devices rarely look up
+ *        other nodes, while controllers do so for every node they talk to.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 64
+#else
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_FRESH_TIME_SECS
+ *
+ * @brief How long, in seconds, a cached node address is used as is after it was resolved.
+ *        Matches the TTL nodes advertise their operational records with.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_FRESH_TIME_SECS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_FRESH_TIME_SECS 120
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_FRESH_TIME_SECS
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_STALE_TIME_SECS
+ *
+ * @brief How long, in seconds, a cached node address remains usable once it is no longer fresh.
+ *        Stale addresses are still handed out right away, while a DNS-SD lookup confirms them
+ *        in the background.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_STALE_TIME_SECS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_STALE_TIME_SECS 3600
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_STALE_TIME_SECS
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_REFRESHES
+ *
+ * @brief Maximum number of background lookups confirming stale cached addresses at a time.
+ *        Stale addresses served while all of them are busy are not confirmed.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_REFRESHES
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_REFRESHES 4
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_MAX_REFRESHES
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
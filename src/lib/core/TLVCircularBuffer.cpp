@@ -106,6 +106,16 @@ void TLVCircularBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     mImplicitProfileId = kCommonProfileId;
 }
 
+CHIP_ERROR TLVCircularBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength, uint32_t inHeadOffset, uint32_t inDataLength)
+{
+    Init(inBuffer, inBufferLength);
+    VerifyOrReturnError(inHeadOffset < inBufferLength && inDataLength <= inBufferLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueueHead   = mQueue + inHeadOffset;
+    mQueueLength = inDataLength;
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *   Evicts the oldest top-level TLV element in the TLVCircularBuffer
@@ -158,6 +168,7 @@ CHIP_ERROR TLVCircularBuffer::EvictHead()
     // update queue state
     mQueueLength = newLen;
     mQueueHead   = newHead;
+    OnQueueChanged();
 
     return CHIP_NO_ERROR;
 }
@@ -249,6 +260,7 @@ CHIP_ERROR TLVCircularBuffer::FinalizeBuffer(TLVWriter & ioWriter, uint8_t * inB
         {
             mQueueLength = static_cast<uint32_t>(tail - mQueueHead);
         }
+        OnQueueChanged();
     }
     return err;
 }
@@ -61,6 +61,21 @@ public:
     TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead);
 
     void Init(uint8_t * inBuffer, uint32_t inBufferLength);
+
+    /**
+     * @brief
+     *   Initialize the buffer over storage that already holds elements, e.g. storage that outlived a previous
+     *   TLVCircularBuffer.
+     *
+     * @param[in] inBuffer       A pointer to the backing store for the queue
+     * @param[in] inBufferLength Length, in bytes, of the backing store
+     * @param[in] inHeadOffset   Offset, in bytes, of the oldest element from the start of the backing store
+     * @param[in] inDataLength   Length, in bytes, of the elements, which wrap around the end of the backing store
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the elements do not fit in the backing store; the buffer is then empty.
+     */
+    CHIP_ERROR Init(uint8_t * inBuffer, uint32_t inBufferLength, uint32_t inHeadOffset, uint32_t inDataLength);
+
     inline uint8_t * QueueHead() const { return mQueueHead; }
     inline uint8_t * QueueTail() const { return mQueue + ((static_cast<size_t>(mQueueHead - mQueue) + mQueueLength) % mQueueSize); }
     inline uint32_t DataLength() const { return mQueueLength; }
@@ -139,6 +154,13 @@ protected:
      */
     void GetCurrentWritableBuffer(uint8_t *& outBufStart, uint32_t & outBufLen) const;
 
+    /**
+     * @brief
+     *   Called whenever the head or the length of the queue changes, i.e. when an element is evicted or when
+     *   a TLVWriter finalizes its output.
+     */
+    virtual void OnQueueChanged() {}
+
 private:
     uint8_t * mQueue;
     uint32_t mQueueSize;
@@ -513,6 +513,26 @@ CHIP_ERROR TLVReader::GetDataPtr(const uint8_t *& data) const
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVReader::GetEncodedElement(ByteSpan & element) const
+{
+    TLVElementType elemType = ElementType();
+    VerifyOrReturnError(mBackingStore == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(elemType != TLVElementType::NotSpecified && elemType != TLVElementType::EndOfContainer,
+                        CHIP_ERROR_INCORRECT_STATE);
+
+    // The head of the element, which includes the value of scalars, is right before the read point.
+    uint8_t elemHeadBytes;
+    ReturnErrorOnFailure(GetElementHeadLength(elemHeadBytes));
+    const uint8_t * elemStart = mReadPoint - elemHeadBytes;
+
+    TLVReader reader;
+    reader.Init(*this);
+    ReturnErrorOnFailure(reader.Skip());
+
+    element = ByteSpan(elemStart, static_cast<size_t>(reader.mReadPoint - elemStart));
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::OpenContainer(TLVReader & containerReader)
 {
     TLVElementType elemType = ElementType();
@@ -888,6 +888,22 @@ public:
      */
     const uint8_t * GetReadPoint() const { return mReadPoint; }
 
+    /**
+     * Get the encoding of the current element in the underlying input buffer, from its control byte to its last byte
+     * (the end-of-container marker, for a container).
+     *
+     * This is only supported for readers of a single contiguous buffer, before the value of the current element has been
+     * read (e.g. with GetBytes() or EnterContainer()).
+     *
+     * @param[out] element                 The encoding of the current element.
+     *
+     * @retval #CHIP_NO_ERROR              If the encoding of the element was found.
+     * @retval #CHIP_ERROR_INCORRECT_STATE If the reader is not positioned on an element, or reads from a TLVBackingStore.
+     * @retval other                        Other CHIP error codes returned while skipping over the element, e.g. if the
+     *                                      underlying TLV encoding ended prematurely.
+     */
+    CHIP_ERROR GetEncodedElement(ByteSpan & element) const;
+
     /**
      * Advances the TLVReader object to immediately after the current TLV element.
      *
@@ -4608,6 +4608,53 @@ TEST_F(TestTLV, CheckGetByteView)
     }
 }
 
+TEST_F(TestTLV, CheckGetEncodedElement)
+{
+    uint8_t buf[64];
+    const uint8_t testBytes[] = { 1, 2, 3 };
+
+    // The encoding of each member of the structure written below.
+    const uint8_t expectedUnsigned[]  = { 0x24, 0x00, 0x05 };
+    const uint8_t expectedBytes[]     = { 0x30, 0x01, 0x03, 0x01, 0x02, 0x03 };
+    const uint8_t expectedStructure[] = { 0x35, 0x02, 0x29, 0x00, 0x18 };
+    const ByteSpan expected[]         = { ByteSpan(expectedUnsigned), ByteSpan(expectedBytes), ByteSpan(expectedStructure) };
+
+    TLVWriter writer;
+    TLVType outer;
+    TLVType inner;
+    writer.Init(buf);
+    EXPECT_EQ(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Put(ContextTag(0), static_cast<uint8_t>(5)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutBytes(ContextTag(1), testBytes, sizeof(testBytes)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.StartContainer(ContextTag(2), kTLVType_Structure, inner), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.PutBoolean(ContextTag(0), true), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(inner), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    ContiguousBufferTLVReader reader;
+    ByteSpan element;
+    reader.Init(buf, writer.GetLengthWritten());
+    EXPECT_EQ(reader.GetEncodedElement(element), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.GetEncodedElement(element), CHIP_NO_ERROR);
+    EXPECT_TRUE(element.data_equal(ByteSpan(buf, writer.GetLengthWritten())));
+
+    EXPECT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+    for (const auto & expectedElement : expected)
+    {
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.GetEncodedElement(element), CHIP_NO_ERROR);
+        EXPECT_TRUE(element.data_equal(expectedElement));
+    }
+
+    // An element that is cut short has no encoding.
+    reader.Init(buf, writer.GetLengthWritten() - 1);
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_NE(reader.GetEncodedElement(element), CHIP_NO_ERROR);
+}
+
 TEST_F(TestTLV, CheckTLVScopedBuffer)
 {
     Platform::ScopedMemoryBuffer<uint8_t> buf;
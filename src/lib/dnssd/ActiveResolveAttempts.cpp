@@ -17,6 +17,7 @@
 
 #include "ActiveResolveAttempts.h"
 
+#include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip;
@@ -29,10 +30,14 @@ constexpr chip::System::Clock::Timeout ActiveResolveAttempts::kMaxRetryDelay;
 void ActiveResolveAttempts::Reset()
 
 {
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+    mRetryQueue.clear();
+#else
     for (auto & item : mRetryQueue)
     {
         item.attempt.Clear();
     }
+#endif
 }
 
 void ActiveResolveAttempts::Complete(const PeerId & peerId)
@@ -132,16 +137,21 @@ void ActiveResolveAttempts::MarkPending(ScheduledAttempt && attempt)
     //     or if equal nextRetryDelay, pick the one with the oldest
     //     queryDueTime
 
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+    GrowFor(attempt);
+    VerifyOrReturn(!mRetryQueue.empty());
+#endif
+
     RetryEntry * entryToUse = &mRetryQueue[0];
 
-    for (size_t i = 1; i < kRetryQueueSize; i++)
+    for (size_t i = 1; i < mRetryQueue.size(); i++)
     {
         if (entryToUse->attempt.Matches(attempt))
         {
             break; // best match possible
         }
 
-        RetryEntry * entry = mRetryQueue + i;
+        RetryEntry * entry = &mRetryQueue[i];
 
         // Rule 1: attempt match always matches
         if (entry->attempt.Matches(attempt))
@@ -194,6 +204,23 @@ void ActiveResolveAttempts::MarkPending(ScheduledAttempt && attempt)
     entryToUse->nextRetryDelay = System::Clock::Seconds16(1);
 }
 
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+void ActiveResolveAttempts::GrowFor(const ScheduledAttempt & attempt)
+{
+    VerifyOrReturn(mRetryQueue.size() < kRetryQueueSize);
+
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.attempt.IsEmpty() || entry.attempt.Matches(attempt))
+        {
+            return;
+        }
+    }
+
+    mRetryQueue.emplace_back();
+}
+#endif // CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+
 std::optional<System::Clock::Timeout> ActiveResolveAttempts::GetTimeUntilNextExpectedResponse() const
 {
     std::optional<System::Clock::Timeout> minDelay = std::nullopt;
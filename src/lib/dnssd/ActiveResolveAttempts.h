@@ -21,12 +21,19 @@
 #include <cstdint>
 #include <optional>
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/PeerId.h>
 #include <lib/dnssd/Resolver.h>
 #include <lib/dnssd/minimal_mdns/core/HeapQName.h>
 #include <lib/support/Variant.h>
 #include <system/SystemClock.h>
 
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+#include <vector>
+#else
+#include <array>
+#endif
+
 namespace mdns {
 namespace Minimal {
 
@@ -38,10 +45,17 @@ namespace Minimal {
 ///    - figuring out a 'next query time' for items in the list
 ///    - iterating through the 'schedule now' items of the list
 ///
+/// With CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS the list grows on demand
+/// up to kRetryQueueSize items, otherwise it always holds kRetryQueueSize items.
+///
 class ActiveResolveAttempts
 {
 public:
-    static constexpr size_t kRetryQueueSize                      = 4;
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+    static constexpr size_t kRetryQueueSize = CHIP_CONFIG_MINMDNS_MAX_RESOLVE_ATTEMPTS;
+#else
+    static constexpr size_t kRetryQueueSize = 4;
+#endif
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
     struct ScheduledAttempt
@@ -314,8 +328,20 @@ private:
         chip::System::Clock::Timeout nextRetryDelay = chip::System::Clock::Seconds16(1);
     };
     void MarkPending(ScheduledAttempt && attempt);
+
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+    /// Adds an empty entry to the queue if the attempt has no matching or free
+    /// entry to use yet and the queue may still grow.
+    void GrowFor(const ScheduledAttempt & attempt);
+#endif
+
     chip::System::Clock::ClockBase * mClock;
-    RetryEntry mRetryQueue[kRetryQueueSize];
+
+#if CHIP_CONFIG_MINMDNS_DYNAMIC_RESOLVE_ATTEMPTS
+    std::vector<RetryEntry> mRetryQueue;
+#else
+    std::array<RetryEntry, kRetryQueueSize> mRetryQueue;
+#endif
 };
 
 } // namespace Minimal
@@ -17,6 +17,8 @@
 
 #include "Resolver.h"
 
+#include <algorithm>
+
 #include <lib/core/CHIPConfig.h>
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
@@ -27,6 +29,7 @@
 #include <lib/dnssd/minimal_mdns/QueryBuilder.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/macros.h>
@@ -45,6 +48,149 @@ constexpr uint16_t kMdnsPort        = 5353;
 
 using namespace mdns::Minimal;
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+
+constexpr QNamePart kOperationalSuffix[]    = { kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+constexpr QNamePart kCommissionableSuffix[] = { kCommissionableServiceName, kCommissionProtocol, kLocalDomain };
+constexpr QNamePart kCommissionerSuffix[]   = { kCommissionerServiceName, kCommissionProtocol, kLocalDomain };
+
+/// Figures out what browse a PTR record name answers, if any
+std::optional<DiscoveryType> BrowseTypeForPtrName(SerializedQNameIterator name)
+{
+    // PTR record names look like:
+    //   _matter._tcp.local, _matterc._udp.local or _matterd._udp.local  (browse all)
+    //   <subtype>._sub.<one of the above>  (browse subtype)
+    do
+    {
+        if (name == kOperationalSuffix)
+        {
+            return std::make_optional(DiscoveryType::kOperational);
+        }
+
+        if (name == kCommissionableSuffix)
+        {
+            return std::make_optional(DiscoveryType::kCommissionableNode);
+        }
+
+        if (name == kCommissionerSuffix)
+        {
+            return std::make_optional(DiscoveryType::kCommissionerNode);
+        }
+    } while (name.Next());
+
+    return std::nullopt;
+}
+
+/// Remembers the PTR records received while browsing.
+///
+/// Browse retries list these as known answers (RFC 6762 section 7.1), so that
+/// nodes that were already discovered do not answer again.
+class BrowseKnownAnswers
+{
+public:
+    /// Remembers (or forgets, for a 0 TTL) the given PTR record.
+    void Add(SerializedQNameIterator name, SerializedQNameIterator target, uint32_t ttlSeconds);
+
+    void Clear();
+
+    /// Adds the known answers that are still worth sending to a query.
+    void AppendTo(QueryBuilder & builder) const;
+
+private:
+    struct Entry
+    {
+        HeapQName name;
+        HeapQName target;
+        System::Clock::Timestamp expiry;
+
+        // A record is only a known answer for the first half of its TTL
+        System::Clock::Timestamp knownAnswerExpiry;
+
+        void Clear()
+        {
+            name   = HeapQName();
+            target = HeapQName();
+        }
+    };
+
+    Entry mEntries[CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS];
+};
+
+void BrowseKnownAnswers::Add(SerializedQNameIterator name, SerializedQNameIterator target, uint32_t ttlSeconds)
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    // Use the entry of the same record, otherwise a free entry, otherwise the one expiring first
+    Entry * entryToUse = nullptr;
+    bool found         = false;
+    for (auto & entry : mEntries)
+    {
+        if (entry.name && (name == entry.name.Content()) && (target == entry.target.Content()))
+        {
+            entryToUse = &entry;
+            found      = true;
+            break;
+        }
+
+        if ((entryToUse == nullptr) || (entryToUse->name && (!entry.name || (entry.expiry < entryToUse->expiry))))
+        {
+            entryToUse = &entry;
+        }
+    }
+
+    if (ttlSeconds == 0)
+    {
+        // Goodbye packet: the record is gone
+        if (found)
+        {
+            entryToUse->Clear();
+        }
+        return;
+    }
+
+    if (!found)
+    {
+        entryToUse->name   = HeapQName(name);
+        entryToUse->target = HeapQName(target);
+        if (!entryToUse->name || !entryToUse->target)
+        {
+            ChipLogError(Discovery, "Memory allocation error for browse known answer");
+            entryToUse->Clear();
+            return;
+        }
+    }
+
+    entryToUse->expiry            = now + System::Clock::Seconds32(ttlSeconds);
+    entryToUse->knownAnswerExpiry = now + System::Clock::Seconds32(ttlSeconds / 2);
+}
+
+void BrowseKnownAnswers::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+void BrowseKnownAnswers::AppendTo(QueryBuilder & builder) const
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    for (auto & entry : mEntries)
+    {
+        if (!entry.name || (entry.knownAnswerExpiry <= now))
+        {
+            continue;
+        }
+
+        PtrResourceRecord record(entry.name.Content(), entry.target.Content());
+        record.SetTtl(std::chrono::duration_cast<System::Clock::Seconds32>(entry.expiry - now).count());
+        builder.AddKnownAnswer(record);
+    }
+}
+
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+
 /// Handles processing of minmdns packet data.
 ///
 /// Can process multiple incremental resolves based on SRV data and allows
@@ -68,6 +214,10 @@ public:
     IncrementalResolver * ResolverBegin() { return mResolvers; }
     IncrementalResolver * ResolverEnd() { return mResolvers + kMinMdnsNumParallelResolvers; }
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    BrowseKnownAnswers & KnownAnswers() { return mKnownAnswers; }
+#endif
+
 private:
     // ParserDelegate implementation
     void OnHeader(ConstHeaderRef & header) override;
@@ -85,6 +235,11 @@ private:
     /// Forwards the resource to all active resolvers.
     void ParseResource(const ResourceData & data);
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    /// Remembers PTR records that answer an active browse.
+    void ParsePtrResource(const ResourceData & data);
+#endif
+
     enum class RecordParsingState
     {
         kIdle,
@@ -103,6 +258,11 @@ private:
     // resolvers kept between parse steps
     ActiveResolveAttempts & mActiveResolves;
     IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
+
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    // browse results kept between packets
+    BrowseKnownAnswers mKnownAnswers;
+#endif
 };
 
 void PacketParser::OnHeader(ConstHeaderRef & header)
@@ -186,8 +346,35 @@ void PacketParser::ParseResource(const ResourceData & data)
     {
         mActiveResolves.CompleteIpResolution(data.GetName());
     }
+
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    if (data.GetType() == QType::PTR)
+    {
+        ParsePtrResource(data);
+    }
+#endif
 }
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+void PacketParser::ParsePtrResource(const ResourceData & data)
+{
+    std::optional<DiscoveryType> browseType = BrowseTypeForPtrName(data.GetName());
+    if (!browseType.has_value() || !mActiveResolves.HasBrowseFor(*browseType))
+    {
+        return;
+    }
+
+    SerializedQNameIterator target;
+    if (!ParsePtrRecord(data.GetData(), mPacketRange, &target))
+    {
+        ChipLogError(Discovery, "Packet data reporter failed to parse PTR record");
+        return;
+    }
+
+    mKnownAnswers.Add(data.GetName(), target, static_cast<uint32_t>(std::min<uint64_t>(data.GetTtlSeconds(), UINT32_MAX)));
+}
+#endif // CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+
 void PacketParser::ParseSRVResource(const ResourceData & data)
 {
     SrvRecord srv;
@@ -300,6 +487,13 @@ private:
     CHIP_ERROR SendAllPendingQueries();
     CHIP_ERROR ScheduleRetries();
 
+    /// Adds the query for the given attempt to the packet being built, sending
+    /// that packet out first if the query does not fit in it anymore.
+    CHIP_ERROR AddToQueryPacket(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
+
+    /// Sends out the packet being built, if it holds any query.
+    CHIP_ERROR SendQueryPacket(QueryBuilder & builder, bool unicastResponse);
+
     /// Prepare a query for the given schedule attempt
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
 
@@ -655,12 +849,61 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
+    ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_BUFFER_TOO_SMALL);
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR MinMdnsResolver::AddToQueryPacket(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt)
+{
+    if (builder.HasPacketBuffer())
+    {
+        CHIP_ERROR err = BuildQuery(builder, attempt);
+        if (err != CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            return err;
+        }
+
+        // Packet is full. The queries that did fit are still valid: send them and start over.
+        ReturnErrorOnFailure(SendQueryPacket(builder, attempt.firstSend));
+    }
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+    ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    builder.Reset(std::move(buffer));
+    builder.Header().SetMessageId(0);
+
+    return BuildQuery(builder, attempt);
+}
+
+CHIP_ERROR MinMdnsResolver::SendQueryPacket(QueryBuilder & builder, bool unicastResponse)
+{
+    if (!builder.HasQueries())
+    {
+        return CHIP_NO_ERROR;
+    }
+
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    // Known answers that do not fit are just left out: they only save responders some work.
+    mPacketParser.KnownAnswers().AppendTo(builder);
+#endif
+
+    if (unicastResponse)
+    {
+        return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort);
+    }
+
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+}
+
 CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
 {
+    // Pack as many queries as possible in each packet rather than sending one
+    // packet per query. Queries asking for a unicast response (first sends)
+    // are sent differently, so they get packets of their own.
+    QueryBuilder unicastResponseQuery;
+    QueryBuilder multicastResponseQuery;
+
     while (true)
     {
         std::optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
@@ -670,24 +913,12 @@ CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
             break;
         }
 
-        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-        QueryBuilder builder(std::move(buffer));
-        builder.Header().SetMessageId(0);
-
-        ReturnErrorOnFailure(BuildQuery(builder, *resolve));
-
-        if (resolve->firstSend)
-        {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
-        }
-        else
-        {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
-        }
+        ReturnErrorOnFailure(AddToQueryPacket(resolve->firstSend ? unicastResponseQuery : multicastResponseQuery, *resolve));
     }
 
+    ReturnErrorOnFailure(SendQueryPacket(unicastResponseQuery, /* unicastResponse = */ true));
+    ReturnErrorOnFailure(SendQueryPacket(multicastResponseQuery, /* unicastResponse = */ false));
+
     ExpireIncrementalResolvers();
 
     return ScheduleRetries();
@@ -722,6 +953,11 @@ CHIP_ERROR MinMdnsResolver::StartDiscovery(DiscoveryType type, DiscoveryFilter f
     // minmdns currently supports only one discovery context at a time so override the previous context
     SetDiscoveryContext(&context);
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    // The new context has not seen any node yet: all of them need to answer again
+    mPacketParser.KnownAnswers().Clear();
+#endif
+
     return BrowseNodes(type, filter);
 }
 
@@ -729,6 +965,10 @@ CHIP_ERROR MinMdnsResolver::StopDiscovery(DiscoveryContext & context)
 {
     SetDiscoveryContext(nullptr);
 
+#if CHIP_CONFIG_MINMDNS_MAX_KNOWN_ANSWERS > 0
+    mPacketParser.KnownAnswers().Clear();
+#endif
+
     return mActiveResolves.CompleteAllBrowses();
 }
 
@@ -22,6 +22,10 @@
 #include <lib/dnssd/minimal_mdns/Parser.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
 #include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <cstring>
 
 namespace mdns {
 namespace Minimal {
@@ -120,6 +124,40 @@ public:
         return *this;
     }
 
+    /// Appends records previously serialized by a ResponseBuilder, as returned by GetRecordBytes.
+    ///
+    /// Only valid on a packet that contains just a header: name compression offsets
+    /// within the records are relative to the start of the packet they were built in.
+    ResponseBuilder & AddSerializedRecords(const chip::ByteSpan & records, uint16_t answerCount, uint16_t additionalCount)
+    {
+        if (!mBuildOk)
+        {
+            return *this;
+        }
+
+        if ((mPacket->DataLength() != HeaderRef::kSizeBytes) || (records.size() > mPacket->AvailableDataLength()))
+        {
+            mBuildOk = false;
+            return *this;
+        }
+
+        memcpy(mPacket->Start() + HeaderRef::kSizeBytes, records.data(), records.size());
+        mEndianOutput.Skip(records.size());
+        mPacket->SetDataLength(static_cast<uint16_t>(mEndianOutput.Needed()));
+        mHeader.SetAnswerCount(answerCount).SetAdditionalCount(additionalCount);
+
+        return *this;
+    }
+
+    /// Bytes serialized after the header so far.
+    ///
+    /// These can be replayed with AddSerializedRecords if the packet contains no queries.
+    chip::ByteSpan GetRecordBytes() const
+    {
+        VerifyOrReturnValue(HasPacketBuffer(), chip::ByteSpan());
+        return chip::ByteSpan(mPacket->Start() + HeaderRef::kSizeBytes, mPacket->DataLength() - HeaderRef::kSizeBytes);
+    }
+
     bool Ok() const { return mBuildOk; }
     bool HasPacketBuffer() const { return !mPacket.IsNull(); }
 
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResponseCache.h"
+
+#include <lib/support/CodeUtils.h>
+
+#include <cctype>
+#include <cstring>
+
+namespace mdns {
+namespace Minimal {
+
+namespace {
+
+// https://tools.ietf.org/html/rfc1035#section-3.1: names are limited to 255 octets
+constexpr size_t kMaxFlatNameLength = 255;
+
+/// Writes the name as length prefixed, lower case labels ending with an empty label.
+///
+/// Query names may use compression pointers into the query packet, so they are
+/// flattened to be compared with names cached from other packets.
+bool FlattenName(SerializedQNameIterator name, uint8_t (&out)[kMaxFlatNameLength], size_t & outLength)
+{
+    outLength = 0;
+    while (name.Next())
+    {
+        // Room for the length byte and the final empty label
+        const size_t labelLength = strlen(name.Value());
+        VerifyOrReturnValue(labelLength + 2 <= kMaxFlatNameLength - outLength, false);
+
+        out[outLength++] = static_cast<uint8_t>(labelLength);
+        for (size_t i = 0; i < labelLength; i++)
+        {
+            out[outLength++] = static_cast<uint8_t>(tolower(static_cast<unsigned char>(name.Value()[i])));
+        }
+    }
+    out[outLength++] = 0;
+    return name.IsValid();
+}
+
+} // namespace
+
+chip::ByteSpan ResponseCache::Entry::GetRecords() const
+{
+    return chip::ByteSpan(mRecords.Get(), mRecords.AllocatedSize());
+}
+
+chip::Span<Internal::QueryResponderInfo * const> ResponseCache::Entry::GetAnswerSources() const
+{
+    return chip::Span<Internal::QueryResponderInfo * const>(mAnswerSources.Get(), mAnswerSources.AllocatedSize());
+}
+
+bool ResponseCache::Entry::Matches(const chip::ByteSpan & name, QType type, QClass klass, chip::Inet::InterfaceId interface) const
+{
+    return InUse() && (mType == type) && (mClass == klass) && (mInterface == interface) &&
+        name.data_equal(chip::ByteSpan(mKey.Get(), mKey.AllocatedSize()));
+}
+
+void ResponseCache::Entry::Clear()
+{
+    mKey.Free();
+    mRecords.Free();
+    mAnswerSources.Free();
+}
+
+const ResponseCache::Entry * ResponseCache::Find(const QueryData & query, chip::Inet::InterfaceId interface,
+                                                 chip::System::Clock::Timestamp now)
+{
+    uint8_t name[kMaxFlatNameLength];
+    size_t nameLength;
+    VerifyOrReturnValue(FlattenName(query.GetName(), name, nameLength), nullptr);
+
+    const chip::ByteSpan key(name, nameLength);
+    for (auto & entry : mEntries)
+    {
+        if (!entry.Matches(key, query.GetType(), query.GetClass(), interface))
+        {
+            continue;
+        }
+
+        if (now - entry.mCreated >= chip::System::Clock::Seconds32(CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS))
+        {
+            entry.Clear();
+            return nullptr;
+        }
+
+        entry.mLastUsed = now;
+        return &entry;
+    }
+    return nullptr;
+}
+
+CHIP_ERROR ResponseCache::Store(const QueryData & query, chip::Inet::InterfaceId interface, const chip::ByteSpan & records,
+                                uint16_t answerCount, uint16_t additionalCount,
+                                chip::Span<Internal::QueryResponderInfo * const> answerSources, chip::System::Clock::Timestamp now)
+{
+    VerifyOrReturnError(IsEnabled(), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(answerSources.size() <= kMaxAnswerSources, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t name[kMaxFlatNameLength];
+    size_t nameLength;
+    VerifyOrReturnError(FlattenName(query.GetName(), name, nameLength), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Prefer an entry for the same query (e.g. an expired one), then a free one, then the least recently used one
+    const chip::ByteSpan key(name, nameLength);
+    Entry * target = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.Matches(key, query.GetType(), query.GetClass(), interface))
+        {
+            target = &entry;
+            break;
+        }
+        if ((target == nullptr) || (target->InUse() && (!entry.InUse() || (entry.mLastUsed < target->mLastUsed))))
+        {
+            target = &entry;
+        }
+    }
+    target->Clear();
+
+    target->mKey.Alloc(nameLength);
+    VerifyOrReturnError(target->mKey.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    memcpy(target->mKey.Get(), name, nameLength);
+
+    if (!records.empty())
+    {
+        target->mRecords.Alloc(records.size());
+        if (target->mRecords.Get() == nullptr)
+        {
+            target->Clear();
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        memcpy(target->mRecords.Get(), records.data(), records.size());
+    }
+
+    if (!answerSources.empty())
+    {
+        target->mAnswerSources.Alloc(answerSources.size());
+        if (target->mAnswerSources.Get() == nullptr)
+        {
+            target->Clear();
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        memcpy(target->mAnswerSources.Get(), answerSources.data(), answerSources.size() * sizeof(answerSources[0]));
+    }
+
+    target->mType            = query.GetType();
+    target->mClass           = query.GetClass();
+    target->mInterface       = interface;
+    target->mAnswerCount     = answerCount;
+    target->mAdditionalCount = additionalCount;
+    target->mCreated         = now;
+    target->mLastUsed        = now;
+
+    return CHIP_NO_ERROR;
+}
+
+void ResponseCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
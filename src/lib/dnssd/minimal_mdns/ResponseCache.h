@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <inet/InetInterface.h>
+#include <system/SystemClock.h>
+
+#include <array>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps serialized replies to mDNS queries, so that repeated queries can be
+/// answered by copying bytes instead of walking all responders again.
+///
+/// Replies are keyed by query name, type and class, and by the interface the
+/// query was received on (address records differ between interfaces).
+///
+/// Cached replies refer to the query responder records they answer with, so the
+/// cache MUST be cleared whenever the set of advertised records changes.
+class ResponseCache
+{
+public:
+    static constexpr size_t kMaxEntries = CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE;
+
+    /// Replies answering with more records than this are not cached
+    static constexpr size_t kMaxAnswerSources = 16;
+
+    /// A cached reply
+    class Entry
+    {
+    public:
+        /// Serialized records, meant to directly follow a DNS header with no queries
+        /// as name compression offsets within them are relative to the packet start.
+        chip::ByteSpan GetRecords() const;
+
+        uint16_t GetAnswerCount() const { return mAnswerCount; }
+        uint16_t GetAdditionalCount() const { return mAdditionalCount; }
+
+        /// The records that generated the 'Answer' section of the reply, used to
+        /// throttle multicast replies.
+        chip::Span<Internal::QueryResponderInfo * const> GetAnswerSources() const;
+
+    private:
+        friend class ResponseCache;
+
+        bool InUse() const { return mKey.Get() != nullptr; }
+        bool Matches(const chip::ByteSpan & name, QType type, QClass klass, chip::Inet::InterfaceId interface) const;
+        void Clear();
+
+        chip::Platform::ScopedMemoryBufferWithSize<uint8_t> mKey; // flattened, lower case query name
+        chip::Platform::ScopedMemoryBufferWithSize<uint8_t> mRecords;
+        chip::Platform::ScopedMemoryBufferWithSize<Internal::QueryResponderInfo *> mAnswerSources;
+        chip::Inet::InterfaceId mInterface;
+        QType mType                              = QType::ANY;
+        QClass mClass                            = QClass::ANY;
+        uint16_t mAnswerCount                    = 0;
+        uint16_t mAdditionalCount                = 0;
+        chip::System::Clock::Timestamp mCreated  = chip::System::Clock::kZero;
+        chip::System::Clock::Timestamp mLastUsed = chip::System::Clock::kZero;
+    };
+
+    static constexpr bool IsEnabled() { return kMaxEntries > 0; }
+
+    /// Returns the cached reply to the given query, or nullptr if there is no such
+    /// reply or it is older than CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE_SECS.
+    const Entry * Find(const QueryData & query, chip::Inet::InterfaceId interface, chip::System::Clock::Timestamp now);
+
+    /// Stores the reply to the given query, replacing the least recently used reply if
+    /// the cache is full.
+    ///
+    /// @param records the serialized records, as described by Entry::GetRecords
+    CHIP_ERROR Store(const QueryData & query, chip::Inet::InterfaceId interface, const chip::ByteSpan & records,
+                     uint16_t answerCount, uint16_t additionalCount,
+                     chip::Span<Internal::QueryResponderInfo * const> answerSources, chip::System::Clock::Timestamp now);
+
+    /// Drops all cached replies
+    void Clear();
+
+private:
+    std::array<Entry, kMaxEntries> mEntries;
+};
+
+} // namespace Minimal
+} // namespace mdns
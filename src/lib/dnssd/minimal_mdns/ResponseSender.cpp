@@ -62,11 +62,13 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (responder == nullptr || responder == queryResponder)
         {
             responder = queryResponder;
+            mResponseCache.Clear();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
+    mResponseCache.Clear();
     mResponders.push_back(queryResponder);
     return CHIP_NO_ERROR;
 #else
@@ -80,6 +82,8 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
     {
         if (*it == queryResponder)
         {
+            // Cached replies may point to records of this responder
+            mResponseCache.Clear();
             *it = nullptr;
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
@@ -107,6 +111,20 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 {
     mSendState.Reset(messageId, query, querySource);
 
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    if (CanCacheReply(configuration))
+    {
+        const ResponseCache::Entry * entry = mResponseCache.Find(query, querySource->Interface, kTimeNow);
+        if ((entry != nullptr) && !IsThrottled(*entry, kTimeNow))
+        {
+            return SendCachedReply(*entry, kTimeNow);
+        }
+
+        // A packet left over by a reply that failed half way would end up in the cache
+        mSendState.SetCacheable(!mResponseBuilder.HasPacketBuffer());
+    }
+
     if (query.IsAnnounceBroadcast())
     {
         // Deny listing large amount of data
@@ -128,10 +146,9 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
+        QueryResponderRecordFilter throttleFilter;
 
         responseFilter.SetReplyFilter(&queryReplyFilter);
 
@@ -141,7 +158,7 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             //
             // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
             //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
+            throttleFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
         }
         for (auto & responder : mResponders)
         {
@@ -151,10 +168,18 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             }
             for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
             {
+                if (!throttleFilter.Accept(it.GetInternal()))
+                {
+                    // Throttled records are still part of the full reply, so this one cannot be cached
+                    mSendState.SetCacheable(false);
+                    continue;
+                }
+
                 it->responder->AddAllResponses(querySource, this, configuration);
                 ReturnErrorOnFailure(mSendState.GetError());
 
                 responder->MarkAdditionalRepliesFor(it);
+                mSendState.AddAnswerSource(it.GetInternal());
 
                 if (!mSendState.SendUnicast())
                 {
@@ -195,6 +220,87 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
+    if (mSendState.IsCacheable())
+    {
+        StoreReplyInCache(kTimeNow);
+    }
+
+    return FlushReply();
+}
+
+bool ResponseSender::CanCacheReply(const ResponseConfiguration & configuration) const
+{
+    VerifyOrReturnValue(ResponseCache::IsEnabled(), false);
+
+    // Announcements and TTL overrides are sent rarely and differ from query replies.
+    VerifyOrReturnValue(!mSendState.GetQuery()->IsAnnounceBroadcast(), false);
+    VerifyOrReturnValue(!configuration.GetTtlSecondsOverride().has_value(), false);
+
+    // Legacy unicast replies repeat the query ahead of the records, which moves all name
+    // compression offsets.
+    return !mSendState.IncludeQuery();
+}
+
+void ResponseSender::StoreReplyInCache(chip::System::Clock::Timestamp now)
+{
+    uint16_t answerCount     = 0;
+    uint16_t additionalCount = 0;
+    chip::ByteSpan records;
+
+    // No packet at all means nothing matched: remember that too, it is the common case
+    // for queries about other devices.
+    if (mResponseBuilder.HasPacketBuffer())
+    {
+        HeaderRef & header = mResponseBuilder.Header();
+        VerifyOrReturn(header.GetQueryCount() == 0 && header.GetAuthorityCount() == 0);
+
+        answerCount     = header.GetAnswerCount();
+        additionalCount = header.GetAdditionalCount();
+        records         = mResponseBuilder.GetRecordBytes();
+    }
+
+    CHIP_ERROR err = mResponseCache.Store(*mSendState.GetQuery(), mSendState.GetSourceInterfaceId(), records, answerCount,
+                                          additionalCount, mSendState.GetAnswerSources(), now);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogDetail(Discovery, "Failed to cache mDNS reply: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+bool ResponseSender::IsThrottled(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const
+{
+    VerifyOrReturnValue(!mSendState.SendUnicast(), false);
+
+    // Same rule as for building replies: a record is multicast at most once per second. Partially
+    // throttled replies are built again, which leaves the throttled records out.
+    QueryResponderRecordFilter throttleFilter;
+    throttleFilter.SetIncludeOnlyMulticastBeforeMS(now - chip::System::Clock::Seconds32(1));
+    for (auto * record : entry.GetAnswerSources())
+    {
+        if (!throttleFilter.Accept(record))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR ResponseSender::SendCachedReply(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now)
+{
+    if (!mSendState.SendUnicast())
+    {
+        for (auto * record : entry.GetAnswerSources())
+        {
+            record->lastMulticastTime = now;
+        }
+    }
+
+    VerifyOrReturnError(entry.GetAnswerCount() != 0 || entry.GetAdditionalCount() != 0, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(PrepareNewReplyPacket());
+    mResponseBuilder.AddSerializedRecords(entry.GetRecords(), entry.GetAnswerCount(), entry.GetAdditionalCount());
+    VerifyOrReturnError(mResponseBuilder.Ok(), CHIP_ERROR_INTERNAL);
+
     return FlushReply();
 }
 
@@ -307,6 +413,8 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
     // failure, hence we can flush and try again. This allows for split replies.
     if (!mResponseBuilder.Ok())
     {
+        // Split replies are not cached, they would not fit in a single packet
+        mSendState.SetCacheable(false);
         mResponseBuilder.Header().SetFlags(mResponseBuilder.Header().GetFlags().SetTruncated(true));
 
         ReturnOnFailure(mSendState.SetError(FlushReply()));
@@ -19,6 +19,7 @@
 
 #include "Parser.h"
 #include "ResponseBuilder.h"
+#include "ResponseCache.h"
 #include "Server.h"
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
@@ -73,11 +74,13 @@ public:
 
     void Reset(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * packet)
     {
-        mMessageId    = messageId;
-        mQuery        = &query;
-        mSource       = packet;
-        mSendError    = CHIP_NO_ERROR;
-        mResourceType = ResourceType::kAnswer;
+        mMessageId         = messageId;
+        mQuery             = &query;
+        mSource            = packet;
+        mSendError         = CHIP_NO_ERROR;
+        mResourceType      = ResourceType::kAnswer;
+        mCacheable         = false;
+        mAnswerSourceCount = 0;
         mSentItems.ClearAll();
     }
 
@@ -110,12 +113,35 @@ public:
     bool GetWasSent(ResponseItemsSent item) const { return mSentItems.Has(item); }
     void MarkWasSent(ResponseItemsSent item) { mSentItems.Set(item); }
 
+    /// Whether the reply being built is complete and fits one packet, so it can be
+    /// stored in the response cache.
+    bool IsCacheable() const { return mCacheable; }
+    void SetCacheable(bool cacheable) { mCacheable = cacheable; }
+
+    /// Remember a record sent as an 'Answer'. Too many of these make the reply non-cacheable.
+    void AddAnswerSource(Internal::QueryResponderInfo * record)
+    {
+        if (mAnswerSourceCount >= mAnswerSources.size())
+        {
+            mCacheable = false;
+            return;
+        }
+        mAnswerSources[mAnswerSourceCount++] = record;
+    }
+    chip::Span<Internal::QueryResponderInfo * const> GetAnswerSources() const
+    {
+        return chip::Span<Internal::QueryResponderInfo * const>(mAnswerSources.data(), mAnswerSourceCount);
+    }
+
 private:
     const QueryData * mQuery                 = nullptr;               // query being replied to
     const chip::Inet::IPPacketInfo * mSource = nullptr;               // Where to send the reply (if unicast)
     uint16_t mMessageId                      = 0;                     // message id for the reply
     ResourceType mResourceType               = ResourceType::kAnswer; // what is being sent right now
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
+    bool mCacheable                          = false;
+    size_t mAnswerSourceCount                = 0;
+    std::array<Internal::QueryResponderInfo *, ResponseCache::kMaxAnswerSources> mAnswerSources;
     chip::BitFlags<ResponseItemsSent> mSentItems;
 };
 
@@ -125,6 +151,10 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// Replies to regular queries are kept in a ResponseCache. Changes to query responders
+/// registered here are detected, however changes to records within those responders are
+/// not: InvalidateResponseCache MUST be called after those.
 class ResponseSender : public ResponderDelegate
 {
 public:
@@ -145,16 +175,26 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Drop cached replies, to be called whenever advertised records change.
+    void InvalidateResponseCache() { mResponseCache.Clear(); }
+
 private:
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
 
+    /// Check if the reply to the current query only depends on the query and the receiving interface
+    bool CanCacheReply(const ResponseConfiguration & configuration) const;
+    void StoreReplyInCache(chip::System::Clock::Timestamp now);
+    bool IsThrottled(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const;
+    CHIP_ERROR SendCachedReply(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now);
+
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
 
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+    ResponseCache mResponseCache;              // previously sent replies
 };
 
 } // namespace Minimal
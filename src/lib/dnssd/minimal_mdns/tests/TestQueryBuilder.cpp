@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/support/CHIPMem.h>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+const QNamePart kService[]   = { "_matterc", "_udp", "local" };
+const QNamePart kInstance1[] = { "ABCD", "_matterc", "_udp", "local" };
+const QNamePart kInstance2[] = { "EFGH", "_matterc", "_udp", "local" };
+const QNamePart kHost[]      = { "1234567890", "local" };
+
+/// Collects the content of a parsed packet
+class PacketContent : public ParserDelegate
+{
+public:
+    PacketContent(const BytesRange & packet) : mPacket(packet) {}
+
+    void OnHeader(ConstHeaderRef & header) override { mIsQuery = header.GetFlags().IsQuery(); }
+
+    void OnQuery(const QueryData & data) override
+    {
+        if (mQueryCount < kMaxQueries)
+        {
+            mQueries[mQueryCount] = data;
+        }
+        mQueryCount++;
+    }
+
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        EXPECT_EQ(type, ResourceType::kAnswer);
+        EXPECT_EQ(data.GetType(), QType::PTR);
+
+        SerializedQNameIterator target;
+        EXPECT_TRUE(ParsePtrRecord(data.GetData(), mPacket, &target));
+        EXPECT_EQ(data.GetName(), FullQName(kService));
+        EXPECT_EQ(target, FullQName(kInstance1));
+        mKnownAnswerTtl = data.GetTtlSeconds();
+        mKnownAnswerCount++;
+    }
+
+    static constexpr size_t kMaxQueries = 8;
+
+    BytesRange mPacket;
+    bool mIsQuery = false;
+    QueryData mQueries[kMaxQueries];
+    size_t mQueryCount       = 0;
+    size_t mKnownAnswerCount = 0;
+    uint64_t mKnownAnswerTtl = 0;
+};
+
+class TestQueryBuilder : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestQueryBuilder, TestMultipleQueriesAndKnownAnswers)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(512));
+    builder.Header().SetMessageId(0);
+    EXPECT_FALSE(builder.HasQueries());
+
+    builder.AddQuery(Query(kService).SetType(QType::ANY));
+    builder.AddQuery(Query(kInstance2).SetType(QType::ANY));
+    builder.AddQuery(Query(kHost).SetType(QType::AAAA).SetAnswerViaUnicast(false));
+    EXPECT_TRUE(builder.Ok());
+    EXPECT_TRUE(builder.HasQueries());
+
+    PtrResourceRecord knownAnswer(kService, kInstance1);
+    knownAnswer.SetTtl(77);
+    builder.AddKnownAnswer(knownAnswer);
+    EXPECT_TRUE(builder.Ok());
+
+    // Queries cannot follow known answers
+    builder.AddQuery(Query(kInstance1));
+    EXPECT_FALSE(builder.Ok());
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    ASSERT_FALSE(packet.IsNull());
+
+    BytesRange packetRange(packet->Start(), packet->Start() + packet->DataLength());
+    PacketContent content(packetRange);
+    EXPECT_TRUE(ParsePacket(packetRange, &content));
+
+    EXPECT_TRUE(content.mIsQuery);
+    ASSERT_EQ(content.mQueryCount, 3u);
+    EXPECT_EQ(content.mQueries[0].GetName(), FullQName(kService));
+    EXPECT_EQ(content.mQueries[1].GetName(), FullQName(kInstance2));
+    EXPECT_EQ(content.mQueries[2].GetName(), FullQName(kHost));
+    EXPECT_EQ(content.mQueries[2].GetType(), QType::AAAA);
+    EXPECT_FALSE(content.mQueries[2].RequestedUnicastAnswer());
+    EXPECT_EQ(content.mKnownAnswerCount, 1u);
+    EXPECT_EQ(content.mKnownAnswerTtl, 77u);
+}
+
+TEST_F(TestQueryBuilder, TestFullPacketKeepsPreviousQueries)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(64));
+    builder.Header().SetMessageId(0);
+
+    size_t queryCount = 0;
+    while (true)
+    {
+        const QNamePart name[] = { (queryCount % 2) ? "ABCD" : "EFGH", "_matterc", "_udp", "local" };
+        builder.AddQuery(Query(name));
+        if (!builder.Ok())
+        {
+            break;
+        }
+        queryCount++;
+    }
+
+    // Names are compressed across queries, so more than one fits
+    EXPECT_GT(queryCount, 1u);
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    ASSERT_FALSE(packet.IsNull());
+
+    BytesRange packetRange(packet->Start(), packet->Start() + packet->DataLength());
+    PacketContent content(packetRange);
+    EXPECT_TRUE(ParsePacket(packetRange, &content));
+    EXPECT_EQ(content.mQueryCount, queryCount);
+}
+
+} // namespace
@@ -351,4 +351,67 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+TEST_F(TestResponseSender, CachedReplyIsReusedUntilInvalidated)
+{
+    CommonTestElements common("test");
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 5353;
+
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Changing records without invalidating the cache keeps sending the previous reply
+    common.queryResponder.AddResponder(&common.txtResponder);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    responseSender.InvalidateResponseCache();
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+}
+
+TEST_F(TestResponseSender, LegacyUnicastRepliesAreNotCached)
+{
+    CommonTestElements common("test");
+    common.packetInfo.Clear();
+    common.packetInfo.SrcPort = 1234;
+
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_EQ(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // The reply includes the query, it is built again every time
+    common.queryResponder.AddResponder(&common.txtResponder);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_EQ(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()), CHIP_NO_ERROR);
+    EXPECT_TRUE(common.server.GetHeaderFound());
+}
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+
 } // namespace
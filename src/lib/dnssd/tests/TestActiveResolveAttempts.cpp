@@ -275,6 +275,42 @@ TEST(TestActiveResolveAttempts, TestLRU)
     EXPECT_LT(i, kMaxIterations);
 }
 
+TEST(TestActiveResolveAttempts, TestFullQueueOfPeers)
+{
+    // validates that as many peers as the queue can hold are all resolved in parallel
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    mockClock.AdvanceMonotonic(4321_ms32);
+
+    for (NodeId i = 1; i <= mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        attempts.MarkPending(MakePeerId(i));
+    }
+
+    // all peers get their first query, none was dropped to make room for another
+    size_t scheduledCount = 0;
+    for (std::optional<ActiveResolveAttempts::ScheduledAttempt> s = attempts.NextScheduled(); s.has_value();
+         s                                                        = attempts.NextScheduled())
+    {
+        EXPECT_TRUE(s->firstSend);
+        scheduledCount++;
+    }
+    EXPECT_EQ(scheduledCount, mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize);
+
+    for (NodeId i = 1; i <= mdns::Minimal::ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        EXPECT_TRUE(attempts.ShouldResolveIpAddress(MakePeerId(i)));
+        attempts.Complete(MakePeerId(i));
+    }
+    EXPECT_FALSE(attempts.GetTimeUntilNextExpectedResponse().has_value());
+
+    // Completed entries are re-used for later peers
+    attempts.MarkPending(MakePeerId(1000));
+    EXPECT_EQ(attempts.NextScheduled(), ScheduledPeer(1000, true));
+    EXPECT_FALSE(attempts.NextScheduled().has_value());
+}
+
 TEST(TestActiveResolveAttempts, TestNextPeerOrdering)
 {
     System::Clock::Internal::MockClock mockClock;
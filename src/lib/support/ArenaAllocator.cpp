@@ -0,0 +1,84 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ArenaAllocator.h"
+
+#include <lib/support/CHIPMem.h>
+
+#include <limits>
+
+namespace chip {
+
+void * ArenaAllocatorBase::Allocate(size_t size, size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > alignof(std::max_align_t))
+    {
+        return nullptr;
+    }
+
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(mCursor) + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+    if (aligned <= reinterpret_cast<uintptr_t>(mEnd) && size <= reinterpret_cast<uintptr_t>(mEnd) - aligned)
+    {
+        mCursor = reinterpret_cast<uint8_t *>(aligned) + size;
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    // Chunk data starts right after the header, which keeps it aligned for any type.
+    size_t capacity = (size > mChunkSize) ? size : mChunkSize;
+    if (capacity > std::numeric_limits<size_t>::max() - sizeof(HeapChunk))
+    {
+        return nullptr;
+    }
+
+    auto * chunk = static_cast<HeapChunk *>(Platform::MemoryAlloc(sizeof(HeapChunk) + capacity));
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+    chunk->mpNext = mpHeapChunks;
+    mpHeapChunks  = chunk;
+
+    uint8_t * data = reinterpret_cast<uint8_t *>(chunk + 1);
+    mCursor        = data + size;
+    mEnd           = data + capacity;
+    return data;
+}
+
+void ArenaAllocatorBase::ReleaseAll()
+{
+    while (mpHeapChunks != nullptr)
+    {
+        HeapChunk * next = mpHeapChunks->mpNext;
+        Platform::MemoryFree(mpHeapChunks);
+        mpHeapChunks = next;
+    }
+
+    mCursor = mInlineChunk;
+    mEnd    = mInlineChunk + mChunkSize;
+}
+
+size_t ArenaAllocatorBase::HeapChunkCount() const
+{
+    size_t count = 0;
+    for (const HeapChunk * chunk = mpHeapChunks; chunk != nullptr; chunk = chunk->mpNext)
+    {
+        count++;
+    }
+    return count;
+}
+
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace chip {
+
+/**
+ * Bump allocator whose allocations are all released at once.
+ *
+ * Memory is carved sequentially out of an inline chunk first, and out of further chunks obtained from
+ * Platform::MemoryAlloc once that one is used up. Individual allocations cannot be freed: ReleaseAll()
+ * (or destroying the arena) gives back everything, heap chunks included. Objects are never destroyed
+ * by the arena, so New() is only meant for types whose destructor does not need to run.
+ *
+ * This suits data whose lifetime is bound to a single operation, where it replaces one heap allocation
+ * per object with none at all for small operations, and with one per chunk for large ones.
+ */
+class ArenaAllocatorBase
+{
+public:
+    /**
+     * Allocate a specified number of bytes.
+     *
+     * @param size      Number of bytes to allocate.
+     * @param alignment Required alignment of the returned region, a power of two.
+     * @return          Pointer to the allocated memory region or nullptr on failure.
+     */
+    void * Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Allocate and construct an object of type T.
+     *
+     * @return Pointer to the constructed object or nullptr on failure.
+     */
+    template <typename T, typename... Args>
+    T * New(Args &&... args)
+    {
+        void * memory = Allocate(sizeof(T), alignof(T));
+        return (memory != nullptr) ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /**
+     * Release every allocation made so far, freeing the heap chunks and rewinding to the inline chunk.
+     */
+    void ReleaseAll();
+
+    /**
+     * Returns the number of heap chunks currently held by the arena.
+     */
+    size_t HeapChunkCount() const;
+
+protected:
+    ArenaAllocatorBase(uint8_t * inlineChunk, size_t chunkSize) :
+        mInlineChunk(inlineChunk), mChunkSize(chunkSize), mCursor(inlineChunk), mEnd(inlineChunk + chunkSize)
+    {}
+    ~ArenaAllocatorBase() { ReleaseAll(); }
+
+private:
+    ArenaAllocatorBase(const ArenaAllocatorBase &)             = delete;
+    ArenaAllocatorBase & operator=(const ArenaAllocatorBase &) = delete;
+
+    struct alignas(std::max_align_t) HeapChunk
+    {
+        HeapChunk * mpNext;
+    };
+
+    uint8_t * const mInlineChunk;
+    const size_t mChunkSize;
+    HeapChunk * mpHeapChunks = nullptr;
+    uint8_t * mCursor;
+    uint8_t * mEnd;
+};
+
+/**
+ * ArenaAllocatorBase with an inline chunk of kChunkSize bytes. Heap chunks are kChunkSize bytes too, unless a
+ * single allocation needs more.
+ */
+template <size_t kChunkSize>
+class ArenaAllocator : public ArenaAllocatorBase
+{
+public:
+    static_assert(kChunkSize > 0, "The inline chunk must not be empty");
+
+    ArenaAllocator() : ArenaAllocatorBase(mInlineChunkStorage, kChunkSize) {}
+
+private:
+    alignas(std::max_align_t) uint8_t mInlineChunkStorage[kChunkSize];
+};
+
+} // namespace chip
@@ -122,6 +122,9 @@ public:
         return StorageKeyName::Formatted("g/s/%s", resumptionIdBase64);
     }
 
+    // Operational node address cache
+    static StorageKeyName AddressResolveCache() { return StorageKeyName::FromConst("g/arc"); }
+
     // Access Control
     static StorageKeyName AccessControlAclEntry(FabricIndex fabric, size_t index)
     {
@@ -0,0 +1,303 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Defines HashIndex, a non-owning open addressing hash index over objects stored elsewhere (typically in
+ *      an ObjectPool), used to replace linear scans over large tables with expected constant time lookups.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Fold a 64-bit key into the 32-bit hash value used by HashIndex.
+ *
+ * HashIndex scrambles the hash itself before using it, so this only needs to avoid discarding key bits.
+ */
+inline constexpr uint32_t HashIndexFold(uint64_t key)
+{
+    return static_cast<uint32_t>(key) ^ static_cast<uint32_t>(key >> 32);
+}
+
+namespace detail {
+
+constexpr size_t kHashIndexMinCapacity = 8;
+
+template <typename T>
+struct HashIndexSlot
+{
+    T * mEntry;
+    uint32_t mHash;
+};
+
+// Smallest power of two table size, of at least kHashIndexMinCapacity slots, that keeps @p count entries at most half full.
+constexpr size_t HashIndexCapacityFor(size_t count)
+{
+    size_t capacity = kHashIndexMinCapacity;
+    while (capacity < count * 2)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Inline slots of a fixed size HashIndex; empty for an index that grows from the heap.
+template <typename T, size_t kMaxEntries>
+struct HashIndexFixedSlots
+{
+    HashIndexSlot<T> mFixedSlots[HashIndexCapacityFor(kMaxEntries)] = {};
+};
+
+template <typename T>
+struct HashIndexFixedSlots<T, 0>
+{
+};
+
+} // namespace detail
+
+/**
+ * A multimap from a 32-bit hash to pointers to objects of type T, implemented as a linear probing hash table.
+ *
+ * The index does not own the objects it refers to, and several objects may share the same hash: lookups take
+ * a predicate that is used to select the wanted object(s) among the entries whose hash matches. Removal uses
+ * backward shift deletion, so no tombstones accumulate.
+ *
+ * When kMaxEntries is 0, storage is allocated from the platform heap and grows by doubling so that the table is
+ * never more than half full. Otherwise the table is held inline, sized for kMaxEntries entries, and never
+ * allocates; this suits indexes over statically sized ObjectPools.
+ *
+ * Entries must not be inserted or removed from within ForEachMatch().
+ */
+template <typename T, size_t kMaxEntries = 0>
+class HashIndex : private detail::HashIndexFixedSlots<T, kMaxEntries>
+{
+public:
+    HashIndex()
+    {
+        if constexpr (kMaxEntries > 0)
+        {
+            mSlots    = this->mFixedSlots;
+            mCapacity = detail::HashIndexCapacityFor(kMaxEntries);
+        }
+    }
+    ~HashIndex()
+    {
+        if constexpr (kMaxEntries == 0)
+        {
+            Platform::MemoryFree(mSlots);
+        }
+    }
+
+    HashIndex(const HashIndex &)             = delete;
+    HashIndex & operator=(const HashIndex &) = delete;
+
+    /**
+     * Ensure that @p count entries can be held without further allocation.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the storage could not be grown, or if @p count exceeds kMaxEntries for a fixed
+     *                              size index; the index is left unchanged.
+     */
+    CHIP_ERROR Reserve(size_t count)
+    {
+        if constexpr (kMaxEntries > 0)
+        {
+            return (count <= kMaxEntries) ? CHIP_NO_ERROR : CHIP_ERROR_NO_MEMORY;
+        }
+        else
+        {
+            size_t capacity = (mCapacity == 0) ? detail::kHashIndexMinCapacity : mCapacity;
+            while (capacity < count * 2)
+            {
+                VerifyOrReturnError(capacity <= SIZE_MAX / 2, CHIP_ERROR_NO_MEMORY);
+                capacity *= 2;
+            }
+            return (capacity == mCapacity) ? CHIP_NO_ERROR : Rehash(capacity);
+        }
+    }
+
+    /**
+     * Add @p entry under @p hash. The same entry must not be inserted twice.
+     *
+     * Insertion never fails when the index already holds at least as many entries as were reserved, e.g. when
+     * an entry is removed and re-inserted under a different hash.
+     */
+    CHIP_ERROR Insert(uint32_t hash, T * entry)
+    {
+        VerifyOrDie(mIterationDepth == 0);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(Reserve(mSize + 1));
+
+        size_t index = HomeSlot(hash);
+        while (mSlots[index].mEntry != nullptr)
+        {
+            index = (index + 1) & (mCapacity - 1);
+        }
+        mSlots[index].mEntry = entry;
+        mSlots[index].mHash  = hash;
+        mSize++;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Remove @p entry, which must have been inserted under @p hash.
+     *
+     * @return true if the entry was found and removed.
+     */
+    bool Remove(uint32_t hash, const T * entry)
+    {
+        VerifyOrDie(mIterationDepth == 0);
+        VerifyOrReturnValue(mSize != 0, false);
+
+        const size_t mask = mCapacity - 1;
+        size_t hole       = HomeSlot(hash);
+        while (mSlots[hole].mEntry != entry || mSlots[hole].mHash != hash)
+        {
+            VerifyOrReturnValue(mSlots[hole].mEntry != nullptr, false);
+            hole = (hole + 1) & mask;
+        }
+
+        // Move any later members of the probe sequence whose home slot does not lie cyclically within
+        // (hole, next] back into the hole, so that lookups never stop early at an empty slot.
+        for (size_t next = (hole + 1) & mask; mSlots[next].mEntry != nullptr; next = (next + 1) & mask)
+        {
+            const size_t home = HomeSlot(mSlots[next].mHash);
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                mSlots[hole] = mSlots[next];
+                hole         = next;
+            }
+        }
+        mSlots[hole].mEntry = nullptr;
+        mSize--;
+        return true;
+    }
+
+    /**
+     * Find the first entry under @p hash for which @p predicate, called as `bool predicate(T *)`, returns true.
+     *
+     * @return the matching entry, or nullptr if there is none.
+     */
+    template <typename Predicate>
+    T * Find(uint32_t hash, Predicate && predicate) const
+    {
+        T * result = nullptr;
+        ForEachMatch(hash, [&](T * entry) {
+            if (predicate(entry))
+            {
+                result = entry;
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        return result;
+    }
+
+    /**
+     * Call @p function, as `Loop function(T *)`, for every entry inserted under @p hash, until it returns
+     * Loop::Break. Entries inserted under other hashes are never visited.
+     *
+     * @return Loop::Break if the function returned Loop::Break, otherwise Loop::Finish.
+     */
+    template <typename Function>
+    Loop ForEachMatch(uint32_t hash, Function && function) const
+    {
+        VerifyOrReturnValue(mSize != 0, Loop::Finish);
+
+        mIterationDepth++;
+        Loop result = Loop::Finish;
+        for (size_t index = HomeSlot(hash); mSlots[index].mEntry != nullptr; index = (index + 1) & (mCapacity - 1))
+        {
+            if (mSlots[index].mHash == hash && function(mSlots[index].mEntry) == Loop::Break)
+            {
+                result = Loop::Break;
+                break;
+            }
+        }
+        mIterationDepth--;
+        return result;
+    }
+
+    /**
+     * Remove all entries, keeping the allocated storage.
+     */
+    void Clear()
+    {
+        VerifyOrDie(mIterationDepth == 0);
+        for (size_t index = 0; index < mCapacity; index++)
+        {
+            mSlots[index].mEntry = nullptr;
+        }
+        mSize = 0;
+    }
+
+    size_t Size() const { return mSize; }
+    bool IsEmpty() const { return mSize == 0; }
+
+private:
+    using Slot = detail::HashIndexSlot<T>;
+
+    // Fibonacci hashing: multiply by 2^32 / phi and keep the top bits, which spreads sequential or otherwise
+    // poorly distributed hashes (such as session IDs) evenly across the table.
+    size_t HomeSlot(uint32_t hash) const
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(hash * 2654435769u)) * mCapacity) >> 32);
+    }
+
+    CHIP_ERROR Rehash(size_t capacity)
+    {
+        Slot * slots = static_cast<Slot *>(Platform::MemoryCalloc(capacity, sizeof(Slot)));
+        VerifyOrReturnError(slots != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        Slot * oldSlots    = mSlots;
+        size_t oldCapacity = mCapacity;
+        mSlots             = slots;
+        mCapacity          = capacity;
+
+        for (size_t oldIndex = 0; oldIndex < oldCapacity; oldIndex++)
+        {
+            if (oldSlots[oldIndex].mEntry == nullptr)
+            {
+                continue;
+            }
+            size_t index = HomeSlot(oldSlots[oldIndex].mHash);
+            while (mSlots[index].mEntry != nullptr)
+            {
+                index = (index + 1) & (mCapacity - 1);
+            }
+            mSlots[index] = oldSlots[oldIndex];
+        }
+        Platform::MemoryFree(oldSlots);
+        return CHIP_NO_ERROR;
+    }
+
+    Slot * mSlots                    = nullptr;
+    size_t mCapacity                 = 0; // Always zero or a power of two.
+    size_t mSize                     = 0;
+    mutable unsigned mIterationDepth = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,233 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/benchmark/Benchmark.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <pw_unit_test/framework.h>
+#include <pw_unit_test/logging_event_handler.h>
+
+#include <json/json.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+
+namespace chip {
+namespace Benchmark {
+namespace {
+
+constexpr char kOutputFlag[]  = "--benchmark_out=";
+constexpr char kVerboseFlag[] = "--verbose";
+
+std::vector<Result> sResults;
+
+System::Clock::Microseconds64 ReadClock(clockid_t clock)
+{
+    struct timespec ts;
+    VerifyOrDie(clock_gettime(clock, &ts) == 0);
+    return System::Clock::Microseconds64(static_cast<uint64_t>(ts.tv_sec) * 1000000u + static_cast<uint64_t>(ts.tv_nsec) / 1000u);
+}
+
+double PerIterationNanoseconds(System::Clock::Microseconds64 total, uint64_t iterations)
+{
+    return (iterations == 0) ? 0.0 : static_cast<double>(total.count()) * 1000.0 / static_cast<double>(iterations);
+}
+
+double ItemsPerSecond(const Result & result)
+{
+    return (result.realTime.count() == 0) ? 0.0
+                                           : static_cast<double>(result.items) * 1e6 / static_cast<double>(result.realTime.count());
+}
+
+void PrintResults()
+{
+    printf("\n%-56s %14s %14s %12s %16s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations", "Items/s");
+    for (const Result & result : sResults)
+    {
+        printf("%-56s %14.0f %14.0f %12" PRIu64, result.name.c_str(), PerIterationNanoseconds(result.realTime, result.iterations),
+               PerIterationNanoseconds(result.cpuTime, result.iterations), result.iterations);
+        if (result.items != 0)
+        {
+            printf(" %16.0f", ItemsPerSecond(result));
+        }
+        for (const auto & counter : result.counters)
+        {
+            printf(" %s=%g", counter.first.c_str(), counter.second);
+        }
+        printf("\n");
+    }
+    fflush(stdout);
+}
+
+CHIP_ERROR WriteJson(const char * path, const char * executable)
+{
+    ::Json::Value root;
+
+    char date[32];
+    time_t now = time(nullptr);
+    struct tm nowTm;
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime_r(&now, &nowTm));
+
+    root["context"]["date"]       = date;
+    root["context"]["executable"] = executable;
+    root["context"]["num_cpus"]   = static_cast<::Json::Int64>(sysconf(_SC_NPROCESSORS_ONLN));
+#ifdef NDEBUG
+    root["context"]["library_build_type"] = "release";
+#else
+    root["context"]["library_build_type"] = "debug";
+#endif
+
+    root["benchmarks"] = ::Json::Value(::Json::arrayValue);
+    for (const Result & result : sResults)
+    {
+        ::Json::Value entry;
+        entry["name"]             = result.name;
+        entry["run_name"]         = result.name;
+        entry["run_type"]         = "iteration";
+        entry["repetitions"]      = 1;
+        entry["repetition_index"] = 0;
+        entry["threads"]          = 1;
+        entry["iterations"]       = static_cast<::Json::UInt64>(result.iterations);
+        entry["real_time"]        = PerIterationNanoseconds(result.realTime, result.iterations);
+        entry["cpu_time"]         = PerIterationNanoseconds(result.cpuTime, result.iterations);
+        entry["time_unit"]        = "ns";
+        if (result.items != 0)
+        {
+            entry["items_per_second"] = ItemsPerSecond(result);
+        }
+        for (const auto & counter : result.counters)
+        {
+            entry[counter.first] = counter.second;
+        }
+        root["benchmarks"].append(entry);
+    }
+
+    std::ofstream output(path, std::ios_base::out | std::ios_base::trunc);
+    VerifyOrReturnError(output, CHIP_ERROR_POSIX(errno));
+
+    ::Json::StreamWriterBuilder builder;
+    std::unique_ptr<::Json::StreamWriter> writer(builder.newStreamWriter());
+    writer->write(root, &output);
+    output << "\n";
+
+    return output.good() ? CHIP_NO_ERROR : CHIP_ERROR_WRITE_FAILED;
+}
+
+} // namespace
+
+void Stopwatch::Restart()
+{
+    mRealStart = ReadClock(CLOCK_MONOTONIC);
+    mCpuStart  = ReadClock(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+System::Clock::Microseconds64 Stopwatch::RealTime() const
+{
+    return ReadClock(CLOCK_MONOTONIC) - mRealStart;
+}
+
+System::Clock::Microseconds64 Stopwatch::CpuTime() const
+{
+    return ReadClock(CLOCK_PROCESS_CPUTIME_ID) - mCpuStart;
+}
+
+Result & RecordResult(const char * name, uint64_t iterations, const Stopwatch & stopwatch, uint64_t items)
+{
+    Result result;
+    result.name       = name;
+    result.iterations = iterations;
+    result.realTime   = stopwatch.RealTime();
+    result.cpuTime    = stopwatch.CpuTime();
+    result.items      = items;
+    sResults.push_back(std::move(result));
+    return sResults.back();
+}
+
+const std::vector<Result> & GetResults()
+{
+    return sResults;
+}
+
+System::Clock::Microseconds64 Percentile(std::vector<System::Clock::Microseconds64> & samples, unsigned percentile)
+{
+    VerifyOrReturnValue(!samples.empty(), System::Clock::Microseconds64(0));
+
+    size_t rank  = (samples.size() * std::min(percentile, 100u) + 99) / 100;
+    size_t index = (rank == 0) ? 0 : rank - 1;
+    std::nth_element(samples.begin(), samples.begin() + static_cast<ptrdiff_t>(index), samples.end());
+    return samples[index];
+}
+
+int RunBenchmarks(int argc, char * argv[])
+{
+    const char * outputPath = nullptr;
+    bool verbose            = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], kOutputFlag, sizeof(kOutputFlag) - 1) == 0)
+        {
+            outputPath = argv[i] + sizeof(kOutputFlag) - 1;
+        }
+        else if (strcmp(argv[i], kVerboseFlag) == 0)
+        {
+            verbose = true;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [%s<file.json>] [%s]\n", argv[0], kOutputFlag, kVerboseFlag);
+            return 1;
+        }
+    }
+
+    if (!verbose)
+    {
+        Logging::SetLogFilter(Logging::kLogCategory_Error);
+    }
+
+    testing::InitGoogleTest(nullptr, static_cast<char **>(nullptr));
+    pw::unit_test::LoggingEventHandler handler;
+    pw::unit_test::RegisterEventHandler(&handler);
+    int status = RUN_ALL_TESTS();
+
+    PrintResults();
+
+    if (outputPath != nullptr)
+    {
+        CHIP_ERROR err = WriteJson(outputPath, argv[0]);
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to write benchmark results to %s: %" CHIP_ERROR_FORMAT "\n", outputPath, err.Format());
+            return 1;
+        }
+    }
+
+    return status;
+}
+
+} // namespace Benchmark
+} // namespace chip
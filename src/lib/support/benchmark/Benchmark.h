@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A minimal harness for host-side micro-benchmarks.
+ *
+ *      Benchmarks are written as pw_unit_test test cases, so that they can reuse the fixtures (such as
+ *      chip::Test::AppContext) that the unit tests already use to bring up a loopback stack. Each test case
+ *      times its own hot loop with a Stopwatch and records the outcome with RecordResult(). RunBenchmarks()
+ *      runs every registered test case, prints a summary and optionally writes the results to a JSON file
+ *      using the same layout as Google Benchmark's --benchmark_out, so that its comparison tooling can be
+ *      used to track regressions between builds.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace Benchmark {
+
+/**
+ * Measures elapsed wall clock and process CPU time from construction (or the last Restart()).
+ */
+class Stopwatch
+{
+public:
+    Stopwatch() { Restart(); }
+
+    void Restart();
+
+    System::Clock::Microseconds64 RealTime() const;
+    System::Clock::Microseconds64 CpuTime() const;
+
+private:
+    System::Clock::Microseconds64 mRealStart;
+    System::Clock::Microseconds64 mCpuStart;
+};
+
+/**
+ * The outcome of a single benchmark.
+ */
+struct Result
+{
+    std::string name;
+    uint64_t iterations = 0;
+    System::Clock::Microseconds64 realTime; ///< Total wall clock time over all iterations.
+    System::Clock::Microseconds64 cpuTime;  ///< Total process CPU time over all iterations.
+    uint64_t items = 0;                     ///< Total items processed, or 0 if not meaningful.
+
+    /// Additional named values (e.g. latency percentiles), emitted as extra fields of the JSON record.
+    std::vector<std::pair<std::string, double>> counters;
+
+    Result & AddCounter(const char * counterName, double value)
+    {
+        counters.emplace_back(counterName, value);
+        return *this;
+    }
+};
+
+/**
+ * Record the outcome of a benchmark that ran @p iterations times since @p stopwatch was started.
+ *
+ * @param items  the number of items (attributes, reports, handshakes...) processed over all iterations, used to
+ *               derive a throughput. Pass 0 when there is no meaningful item count.
+ *
+ * @return the recorded result, to which counters may be added.
+ */
+Result & RecordResult(const char * name, uint64_t iterations, const Stopwatch & stopwatch, uint64_t items = 0);
+
+/**
+ * All results recorded so far, in recording order.
+ */
+const std::vector<Result> & GetResults();
+
+/**
+ * Return the value at @p percentile (0 to 100) of @p samples, using nearest-rank selection. Reorders @p samples.
+ */
+System::Clock::Microseconds64 Percentile(std::vector<System::Clock::Microseconds64> & samples, unsigned percentile);
+
+/**
+ * Entry point for benchmark executables.
+ *
+ * Runs all registered test cases, prints a summary of the recorded results and, when invoked with
+ * `--benchmark_out=<path>`, writes them to <path> as JSON. Logging is restricted to errors unless
+ * `--verbose` is given, since log output would otherwise dominate the measurements.
+ *
+ * @return 0 if all test cases passed and the results could be written, non-zero otherwise.
+ */
+int RunBenchmarks(int argc, char * argv[]);
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/ArenaAllocator.h>
+#include <lib/support/CHIPMem.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+
+using namespace chip;
+
+namespace {
+
+struct Node
+{
+    Node(uint32_t value, Node * next) : mValue(value), mpNext(next) {}
+
+    uint32_t mValue;
+    Node * mpNext;
+};
+
+class TestArenaAllocator : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+bool IsAligned(const void * ptr, size_t alignment)
+{
+    return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+}
+
+TEST_F(TestArenaAllocator, TestInlineChunkFirst)
+{
+    ArenaAllocator<4 * sizeof(Node)> arena;
+
+    Node * list = nullptr;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        list = arena.New<Node>(i, list);
+        ASSERT_NE(list, nullptr);
+        EXPECT_TRUE(IsAligned(list, alignof(Node)));
+    }
+    EXPECT_EQ(arena.HeapChunkCount(), 0u);
+
+    uint32_t expected = 4;
+    for (Node * node = list; node != nullptr; node = node->mpNext)
+    {
+        EXPECT_EQ(node->mValue, --expected);
+    }
+    EXPECT_EQ(expected, 0u);
+}
+
+TEST_F(TestArenaAllocator, TestGrowsIntoHeapChunks)
+{
+    ArenaAllocator<2 * sizeof(Node)> arena;
+
+    Node * list = nullptr;
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        list = arena.New<Node>(i, list);
+        ASSERT_NE(list, nullptr);
+        EXPECT_TRUE(IsAligned(list, alignof(Node)));
+    }
+    EXPECT_EQ(arena.HeapChunkCount(), 3u);
+
+    // Earlier allocations are left untouched by later chunks.
+    uint32_t expected = 7;
+    for (Node * node = list; node != nullptr; node = node->mpNext)
+    {
+        EXPECT_EQ(node->mValue, --expected);
+    }
+    EXPECT_EQ(expected, 0u);
+
+    arena.ReleaseAll();
+    EXPECT_EQ(arena.HeapChunkCount(), 0u);
+}
+
+TEST_F(TestArenaAllocator, TestOversizedAllocation)
+{
+    ArenaAllocator<16> arena;
+
+    uint8_t * small = static_cast<uint8_t *>(arena.Allocate(8, 1));
+    ASSERT_NE(small, nullptr);
+
+    // Larger than a chunk: gets a heap chunk of its own.
+    uint8_t * large = static_cast<uint8_t *>(arena.Allocate(100));
+    ASSERT_NE(large, nullptr);
+    EXPECT_TRUE(IsAligned(large, alignof(std::max_align_t)));
+    EXPECT_EQ(arena.HeapChunkCount(), 1u);
+    memset(large, 0xAA, 100);
+
+    EXPECT_EQ(arena.Allocate(4, 3), nullptr);
+}
+
+TEST_F(TestArenaAllocator, TestReleaseAllRewinds)
+{
+    ArenaAllocator<4 * sizeof(Node)> arena;
+
+    Node * first = arena.New<Node>(1u, nullptr);
+    ASSERT_NE(first, nullptr);
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        EXPECT_NE(arena.New<Node>(i, nullptr), nullptr);
+    }
+    EXPECT_GT(arena.HeapChunkCount(), 0u);
+
+    arena.ReleaseAll();
+    EXPECT_EQ(arena.HeapChunkCount(), 0u);
+    EXPECT_EQ(arena.New<Node>(2u, nullptr), first);
+}
+
+} // namespace
@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/HashIndex.h>
+
+namespace {
+
+using namespace chip;
+
+struct Entry
+{
+    uint32_t mKey;
+    bool mIndexed = false;
+};
+
+class TestHashIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+template <size_t kMaxEntries>
+size_t CountMatches(const HashIndex<Entry, kMaxEntries> & index, uint32_t hash)
+{
+    size_t count = 0;
+    index.ForEachMatch(hash, [&count](Entry *) {
+        ++count;
+        return Loop::Continue;
+    });
+    return count;
+}
+
+TEST_F(TestHashIndex, TestEmpty)
+{
+    HashIndex<Entry> index;
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_EQ(index.Find(1, [](Entry *) { return true; }), nullptr);
+    EXPECT_EQ(CountMatches(index, 1), 0u);
+
+    Entry entry{ 1 };
+    EXPECT_FALSE(index.Remove(1, &entry));
+}
+
+TEST_F(TestHashIndex, TestInsertFindRemove)
+{
+    HashIndex<Entry> index;
+    Entry entries[3] = { { 10 }, { 20 }, { 30 } };
+
+    for (auto & entry : entries)
+    {
+        EXPECT_EQ(index.Insert(entry.mKey, &entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Size(), 3u);
+
+    for (auto & entry : entries)
+    {
+        EXPECT_EQ(index.Find(entry.mKey, [](Entry *) { return true; }), &entry);
+    }
+    EXPECT_EQ(index.Find(40, [](Entry *) { return true; }), nullptr);
+
+    // Removing under the wrong hash must not find the entry.
+    EXPECT_FALSE(index.Remove(entries[0].mKey, &entries[1]));
+
+    EXPECT_TRUE(index.Remove(entries[1].mKey, &entries[1]));
+    EXPECT_FALSE(index.Remove(entries[1].mKey, &entries[1]));
+    EXPECT_EQ(index.Size(), 2u);
+    EXPECT_EQ(index.Find(entries[1].mKey, [](Entry *) { return true; }), nullptr);
+    EXPECT_EQ(index.Find(entries[0].mKey, [](Entry *) { return true; }), &entries[0]);
+    EXPECT_EQ(index.Find(entries[2].mKey, [](Entry *) { return true; }), &entries[2]);
+
+    index.Clear();
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_EQ(index.Find(entries[0].mKey, [](Entry *) { return true; }), nullptr);
+}
+
+TEST_F(TestHashIndex, TestDuplicateHashes)
+{
+    HashIndex<Entry> index;
+    Entry entries[5] = { { 1 }, { 2 }, { 3 }, { 4 }, { 5 } };
+
+    // All entries share a hash and are told apart by the predicate.
+    for (auto & entry : entries)
+    {
+        EXPECT_EQ(index.Insert(7, &entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(CountMatches(index, 7), 5u);
+    EXPECT_EQ(CountMatches(index, 8), 0u);
+
+    for (auto & entry : entries)
+    {
+        EXPECT_EQ(index.Find(7, [&entry](Entry * candidate) { return candidate->mKey == entry.mKey; }), &entry);
+    }
+
+    EXPECT_TRUE(index.Remove(7, &entries[2]));
+    EXPECT_EQ(CountMatches(index, 7), 4u);
+    EXPECT_EQ(index.Find(7, [](Entry * candidate) { return candidate->mKey == 3; }), nullptr);
+    EXPECT_EQ(index.Find(7, [](Entry * candidate) { return candidate->mKey == 5; }), &entries[4]);
+
+    size_t visited = 0;
+    EXPECT_EQ(index.ForEachMatch(7,
+                                 [&visited](Entry *) {
+                                     ++visited;
+                                     return Loop::Break;
+                                 }),
+              Loop::Break);
+    EXPECT_EQ(visited, 1u);
+}
+
+TEST_F(TestHashIndex, TestGrowAndChurn)
+{
+    constexpr size_t kCount = 1000;
+    static Entry entries[kCount];
+    HashIndex<Entry> index;
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        // Use a small key space so that probe sequences collide and wrap around.
+        entries[i].mKey     = static_cast<uint32_t>(i % 97);
+        entries[i].mIndexed = true;
+        ASSERT_EQ(index.Insert(entries[i].mKey, &entries[i]), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Size(), kCount);
+
+    // Remove every third entry, then check that exactly the remaining ones are still reachable.
+    for (size_t i = 0; i < kCount; i += 3)
+    {
+        EXPECT_TRUE(index.Remove(entries[i].mKey, &entries[i]));
+        entries[i].mIndexed = false;
+    }
+
+    size_t total = 0;
+    for (uint32_t key = 0; key < 97; key++)
+    {
+        index.ForEachMatch(key, [&](Entry * entry) {
+            EXPECT_EQ(entry->mKey, key);
+            EXPECT_TRUE(entry->mIndexed);
+            ++total;
+            return Loop::Continue;
+        });
+    }
+    EXPECT_EQ(total, index.Size());
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        Entry * found = index.Find(entries[i].mKey, [&](Entry * candidate) { return candidate == &entries[i]; });
+        EXPECT_EQ(found, entries[i].mIndexed ? &entries[i] : nullptr);
+    }
+}
+
+TEST_F(TestHashIndex, TestReserve)
+{
+    HashIndex<Entry> index;
+    Entry entries[16];
+
+    EXPECT_EQ(index.Reserve(16), CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        entries[i].mKey = i;
+        EXPECT_EQ(index.Insert(i, &entries[i]), CHIP_NO_ERROR);
+    }
+
+    // Re-keying an entry at full reservation must not need to grow.
+    EXPECT_TRUE(index.Remove(3, &entries[3]));
+    entries[3].mKey = 100;
+    EXPECT_EQ(index.Insert(100, &entries[3]), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Find(100, [](Entry *) { return true; }), &entries[3]);
+    EXPECT_EQ(index.Find(3, [](Entry *) { return true; }), nullptr);
+}
+
+TEST_F(TestHashIndex, TestFixedCapacity)
+{
+    constexpr size_t kMaxEntries = 5;
+    HashIndex<Entry, kMaxEntries> index;
+    Entry entries[kMaxEntries + 1];
+
+    EXPECT_EQ(index.Reserve(kMaxEntries), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Reserve(kMaxEntries + 1), CHIP_ERROR_NO_MEMORY);
+
+    for (uint32_t i = 0; i < kMaxEntries; i++)
+    {
+        // Every other entry shares a hash, so that probe sequences collide.
+        entries[i].mKey = i / 2;
+        EXPECT_EQ(index.Insert(entries[i].mKey, &entries[i]), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Insert(100, &entries[kMaxEntries]), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(index.Size(), kMaxEntries);
+    EXPECT_EQ(CountMatches(index, 0), 2u);
+    EXPECT_EQ(CountMatches(index, 2), 1u);
+
+    // Once an entry is removed, there is room for another one.
+    EXPECT_TRUE(index.Remove(entries[1].mKey, &entries[1]));
+    EXPECT_EQ(index.Insert(100, &entries[kMaxEntries]), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Find(100, [](Entry *) { return true; }), &entries[kMaxEntries]);
+    EXPECT_EQ(index.Find(0, [](Entry *) { return true; }), &entries[0]);
+
+    index.Clear();
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_EQ(CountMatches(index, 0), 0u);
+    EXPECT_EQ(index.Insert(entries[0].mKey, &entries[0]), CHIP_NO_ERROR);
+}
+
+} // namespace
@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -48,10 +49,24 @@ using namespace chip::System::Clock::Literals;
 namespace chip {
 namespace Messaging {
 
+namespace {
+
+// See section "4.11.8. Parameters and Constants":
+// MRP_BACKOFF_MARGIN = 1.1
+constexpr uint32_t MRP_BACKOFF_MARGIN_NUMERATOR   = 1127;
+constexpr uint32_t MRP_BACKOFF_MARGIN_DENOMINATOR = 1024;
+
+// Retransmitting before the peer's standalone acknowledgement is due would resend messages that were received fine.
+static_assert(System::Clock::Milliseconds64(CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT) * MRP_BACKOFF_MARGIN_DENOMINATOR >=
+                  System::Clock::Milliseconds64(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT) * MRP_BACKOFF_MARGIN_NUMERATOR,
+              "CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT must cover the peer's standalone acknowledgement delay");
+
+} // namespace
+
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), initialSendTime(0), sendCount(0)
 {
     ec->SetWaitingForAck(true);
 }
@@ -219,9 +234,6 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
     // See section "4.11.8. Parameters and Constants" for the parameters below:
     // MRP_BACKOFF_JITTER = 0.25
     constexpr uint32_t MRP_BACKOFF_JITTER_BASE = 1024;
-    // MRP_BACKOFF_MARGIN = 1.1
-    constexpr uint32_t MRP_BACKOFF_MARGIN_NUMERATOR   = 1127;
-    constexpr uint32_t MRP_BACKOFF_MARGIN_DENOMINATOR = 1024;
     // MRP_BACKOFF_BASE = 1.6
     constexpr uint32_t MRP_BACKOFF_BASE_NUMERATOR   = 16;
     constexpr uint32_t MRP_BACKOFF_BASE_DENOMINATOR = 10;
@@ -274,8 +286,18 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
     return std::chrono::duration_cast<System::Clock::Timeout>(mrpBackoffTime);
 }
 
+System::Clock::Timeout ReliableMessageMgr::GetAdaptiveBaseInterval(System::Clock::Timeout estimatedTimeout,
+                                                                   System::Clock::Timeout activeInterval)
+{
+    // Never retransmit later than the advertised active interval, even if it is below the floor.
+    const System::Clock::Timeout minInterval =
+        std::min<System::Clock::Timeout>(CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT, activeInterval);
+    return std::clamp<System::Clock::Timeout>(estimatedTimeout, minInterval, activeInterval);
+}
+
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+    entry->initialSendTime = System::SystemClock().GetMonotonicTimestamp();
     CalculateNextRetransTime(*entry);
     StartTimer();
 }
@@ -286,6 +308,8 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+            SampleRoundTripTime(*entry);
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
 
@@ -464,6 +488,27 @@ void ReliableMessageMgr::SetAdditionalMRPBackoffTime(const Optional<System::Cloc
     sAdditionalMRPBackoffTime = additionalTime.ValueOr(CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST);
 }
 
+void ReliableMessageMgr::SampleRoundTripTime(const RetransTableEntry & entry)
+{
+    // Karn's algorithm: the acknowledgement of a retransmitted message may answer any of its transmissions.
+    VerifyOrReturn(entry.sendCount == 0 && entry.ec->HasSessionHandle());
+
+    const SessionHandle & session = entry.ec->GetSessionHandle();
+    VerifyOrReturn(session->IsSecureSession());
+
+    const System::Clock::Milliseconds32 rtt = std::chrono::duration_cast<System::Clock::Milliseconds32>(
+        System::SystemClock().GetMonotonicTimestamp() - entry.initialSendTime);
+
+    Transport::RoundTripTimeEstimator & estimator = session->AsSecureSession()->GetRoundTripTimeEstimator();
+    estimator.AddSample(rtt);
+
+    ChipLogDetail(ExchangeManager,
+                  "MRP RTT %" PRIu32 "ms, SRTT %" PRIu32 "ms, RTTVAR %" PRIu32 "ms on exchange " ChipLogFormatExchange,
+                  rtt.count(), estimator.GetSmoothedRtt().count(), estimator.GetRttVariation().count(),
+                  ChipLogValueExchange(&entry.ec.Get()));
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRoundTripTime, rtt.count());
+}
+
 void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 {
     System::Clock::Timeout baseTimeout = System::Clock::Timeout(0);
@@ -481,6 +526,22 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = entry.ec->GetSessionHandle()->GetMRPBaseTimeout();
     }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+    const SessionHandle & session = entry.ec->GetSessionHandle();
+    if (session->IsSecureSession())
+    {
+        const Transport::SecureSession * secureSession = session->AsSecureSession();
+        const auto & estimator                         = secureSession->GetRoundTripTimeEstimator();
+
+        // Only shorten the active interval: a peer that may be idle needs its idle interval to wake up and acknowledge.
+        if ((entry.ec->HasReceivedAtLeastOneMessage() || secureSession->IsPeerActive()) && estimator.HasEstimate())
+        {
+            baseTimeout = GetAdaptiveBaseInterval(estimator.GetRetransmissionTimeout(),
+                                                  secureSession->GetRemoteMRPConfig().mActiveRetransTimeout);
+        }
+    }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
 }
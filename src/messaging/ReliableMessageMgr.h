@@ -64,6 +64,7 @@ public:
         ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
         EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+        System::Clock::Timestamp initialSendTime; /**< The time the message was first sent, used to measure round trip times. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
     };
@@ -115,6 +116,20 @@ public:
     static System::Clock::Timeout GetBackoff(System::Clock::Timeout baseInterval, uint8_t sendCount,
                                              bool computeMaxPossible = false);
 
+    /**
+     *  Calculate the base interval for retransmissions to an active peer from the retransmission
+     *  timeout estimated from measured round trip times, as used when
+     *  CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT is enabled.
+     *
+     *  @param[in]   estimatedTimeout     The retransmission timeout estimated for the session.
+     *  @param[in]   activeInterval       The active interval advertised by the peer.
+     *
+     *  @retval  The estimate, bounded below by CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT and
+     *           above by the active interval.
+     */
+    static System::Clock::Timeout GetAdaptiveBaseInterval(System::Clock::Timeout estimatedTimeout,
+                                                          System::Clock::Timeout activeInterval);
+
     /**
      *  Start retranmisttion of cached encryped packet for current entry.
      *
@@ -222,6 +237,14 @@ public:
     static void SetAdditionalMRPBackoffTime(const Optional<System::Clock::Timeout> & additionalTime);
 
 private:
+    /**
+     * Adds the time taken for the entry to be acknowledged to the round trip time estimates
+     * of its session, unless the entry was retransmitted.
+     *
+     * @param[in] entry RetransTableEntry that was just acknowledged
+     */
+    void SampleRoundTripTime(const RetransTableEntry & entry);
+
     /**
      * Calculates the next retransmission time for the entry
      * Function sets the nextRetransTime of the entry
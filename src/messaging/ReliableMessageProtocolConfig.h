@@ -183,6 +183,45 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    Should the base interval of retransmissions to an active peer be derived
+ *    from the round trip times measured on the session.
+ *
+ *  The round trip time to the peer is estimated from the acknowledgements of
+ *  messages that were not retransmitted (see RFC 6298). When enabled and an
+ *  estimate exists, the estimated retransmission timeout replaces the active
+ *  interval advertised by the peer, bounded below by
+ *  CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT and above by the advertised
+ *  active interval, so retransmissions never happen later than without it.
+ *  Retransmissions to a peer that may be idle always use its idle interval.
+ *
+ *  This mostly benefits low latency links, such as Ethernet or Wi-Fi, where the
+ *  advertised intervals are far longer than the actual round trip time.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    The shortest base retransmission interval used when
+ *    CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT is enabled.
+ *
+ *  A peer may hold back the acknowledgement of a message for up to
+ *  CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT, waiting to piggyback it on a response,
+ *  so this must be at least that timeout scaled by MRP_BACKOFF_MARGIN (1.1).
+ *  Otherwise a fast link would retransmit every message whose response takes
+ *  a little while to produce.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT (250_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
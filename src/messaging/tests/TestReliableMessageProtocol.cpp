@@ -1751,6 +1751,62 @@ TEST_F(TestReliableMessageProtocol, CheckGetBackoffAdditionalTime)
     CheckGetBackoffImpl(System::Clock::Seconds32(1));
 }
 
+TEST_F(TestReliableMessageProtocol, CheckAdaptiveBaseInterval)
+{
+    constexpr System::Clock::Timeout kFloor = CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT;
+
+    // The estimate is bounded below by the floor, which covers the peer's standalone acknowledgement delay...
+    EXPECT_EQ(ReliableMessageMgr::GetAdaptiveBaseInterval(1_ms32, 2000_ms32), kFloor);
+    EXPECT_GE(ReliableMessageMgr::GetAdaptiveBaseInterval(1_ms32, 2000_ms32), CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+
+    // ...and above by the active interval advertised by the peer.
+    EXPECT_EQ(ReliableMessageMgr::GetAdaptiveBaseInterval(kFloor + 100_ms32, 2000_ms32), kFloor + 100_ms32);
+    EXPECT_EQ(ReliableMessageMgr::GetAdaptiveBaseInterval(5000_ms32, 2000_ms32), 2000_ms32);
+
+    // An active interval below the floor is never lengthened.
+    EXPECT_EQ(ReliableMessageMgr::GetAdaptiveBaseInterval(1_ms32, 50_ms32), 50_ms32);
+}
+
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+TEST_F(TestReliableMessageProtocol, CheckAdaptiveRetransTimeout)
+{
+    MockAppDelegate mockAppDelegate(*this);
+    ExchangeContext * exchange = NewExchangeToAlice(&mockAppDelegate);
+    ASSERT_NE(exchange, nullptr);
+
+    ReliableMessageMgr * rm     = GetExchangeManager().GetReliableMessageMgr();
+    ReliableMessageContext * rc = exchange->GetReliableMessageContext();
+    ASSERT_NE(rm, nullptr);
+    ASSERT_NE(rc, nullptr);
+
+    SecureSession * session = exchange->GetSessionHandle()->AsSecureSession();
+    session->SetRemoteSessionParameters(ReliableMessageProtocolConfig(2000_ms32, 2000_ms32));
+    session->MarkActiveRx();
+
+    // A loopback round trip yields an estimate far below the peer's acknowledgement delay.
+    RoundTripTimeEstimator & estimator = session->GetRoundTripTimeEstimator();
+    estimator.Reset();
+    estimator.AddSample(1_ms32);
+    ASSERT_LT(estimator.GetRetransmissionTimeout(), System::Clock::Timeout(CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT));
+
+    ReliableMessageMgr::RetransTableEntry * entry;
+    ASSERT_EQ(rm->AddToRetransTable(rc, &entry), CHIP_NO_ERROR);
+    rm->StartRetransmision(entry);
+
+    // The first retransmission is scheduled from the floor, not from the raw estimate or the advertised interval.
+    const System::Clock::Timeout baseInterval = CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT;
+    const System::Clock::Timeout margin       = System::Clock::Timeout(15);
+    const System::Clock::Timeout backoff      = entry->nextRetransTime - entry->initialSendTime;
+    EXPECT_GE(backoff, baseInterval);
+    EXPECT_LE(backoff, ReliableMessageMgr::GetBackoff(baseInterval, 0, true /* computeMaxPossible */) + margin);
+
+    rm->ClearRetransTable(*entry);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    exchange->Close();
+}
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
 TEST_F(TestReliableMessageProtocol, CheckApplicationResponseDelayed)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -54,6 +54,40 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG
+ *
+ * When enabled, the key-value store persists each write by appending it to a log file next to the KVS file, instead of
+ * rewriting the whole KVS file. The log is replayed when the KVS is initialized, and compacted into the KVS file once it
+ * grows past CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE bytes.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE
+ *
+ * The size in bytes past which the key-value store log is compacted into the KVS file, when
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG is enabled.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_FLUSH_WINDOW_MS
+ *
+ * When CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG is enabled, the time in milliseconds during which key-value store writes
+ * are accumulated before being written to the log with a single write and sync.
+ *
+ * With the default of 0, each write is synced to the log before it completes. A non-zero window makes bursts of writes
+ * (e.g. during commissioning) cheaper, at the cost of losing the writes of the last window on power loss.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_FLUSH_WINDOW_MS
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_FLUSH_WINDOW_MS 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_FLUSH_WINDOW_MS
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -68,6 +102,21 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+// Background work, such as the certificate and signature checks of CASE handshakes, runs on the CHIP task unless
+// the build enables a pool of background tasks (chip_device_config_enable_bg_event_processing=true), so that
+// concurrent handshakes are spread over several cores.
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+#define CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING 0
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 4
+#endif // CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+
+#ifndef CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 64
+#endif // CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
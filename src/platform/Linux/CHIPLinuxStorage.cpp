@@ -47,9 +47,31 @@ ChipLinuxStorage::ChipLinuxStorage()
     mDirty = false;
 }
 
-ChipLinuxStorage::~ChipLinuxStorage() {}
+ChipLinuxStorage::~ChipLinuxStorage()
+{
+    // A queued start of the flush timer must not reach this object once it is gone.
+    if (mLogFlushRequest)
+    {
+        std::lock_guard<std::mutex> requestLock(mLogFlushRequest->mLock);
+        mLogFlushRequest->mStorage = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    // Neither must the flush timer, if it was already started.
+    if (mLogFlushScheduled)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(HandleLogFlushTimer, this);
+        mLogFlushScheduled = false;
+    }
+
+    if (mLog.HasPendingRecords())
+    {
+        FlushLogLocked();
+    }
+}
 
-CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
+CHIP_ERROR ChipLinuxStorage::Init(const char * configFile, CommitMode commitMode, System::Clock::Milliseconds32 logFlushWindow)
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
 
@@ -62,7 +84,9 @@ CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
     }
 
     mConfigPath.assign(configFile);
-    retval = ChipLinuxStorageIni::Init();
+    mCommitMode     = commitMode;
+    mLogFlushWindow = logFlushWindow;
+    retval          = ChipLinuxStorageIni::Init();
 
     if (retval == CHIP_NO_ERROR)
     {
@@ -73,9 +97,7 @@ CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
         // Create default setting file if not exist.
         if (!ifs.good())
         {
-            mDirty = true;
-            retval = Commit();
-            mDirty = false;
+            retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
         }
     }
 
@@ -84,6 +106,12 @@ CHIP_ERROR ChipLinuxStorage::Init(const char * configFile)
         retval = ChipLinuxStorageIni::AddConfig(mConfigPath);
     }
 
+    // The log holds the writes made since the configuration file was last written, so it is replayed on top of it.
+    if (retval == CHIP_NO_ERROR && mCommitMode == CommitMode::kAppendLog)
+    {
+        retval = mLog.Open(mConfigPath + ".log", *this);
+    }
+
     mInitialized = true;
 
     return retval;
@@ -218,9 +246,22 @@ CHIP_ERROR ChipLinuxStorage::WriteValueStr(const char * key, const char * val)
 
     mLock.lock();
 
-    retval = ChipLinuxStorageIni::AddEntry(key, val);
+    // Check that the write can be logged before making it, so that a rejected write changes nothing.
+    if (mLog.IsOpen() && !ChipLinuxStorageLog::CanAppend(key, val))
+    {
+        retval = CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    else
+    {
+        retval = ChipLinuxStorageIni::AddEntry(key, val);
 
-    mDirty = true;
+        if (retval == CHIP_NO_ERROR && mLog.IsOpen())
+        {
+            retval = mLog.Append(ChipLinuxStorageLog::RecordType::kPut, key, val);
+        }
+
+        mDirty = true;
+    }
 
     mLock.unlock();
 
@@ -276,10 +317,16 @@ CHIP_ERROR ChipLinuxStorage::ClearValue(const char * key)
 
     mLock.lock();
 
-    retval = ChipLinuxStorageIni::RemoveEntry(key);
-
-    if (retval == CHIP_NO_ERROR)
+    if (mLog.IsOpen() && !ChipLinuxStorageLog::CanAppend(key, nullptr))
     {
+        retval = CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    else if (ChipLinuxStorageIni::RemoveEntry(key) == CHIP_NO_ERROR)
+    {
+        if (mLog.IsOpen())
+        {
+            retval = mLog.Append(ChipLinuxStorageLog::RecordType::kDelete, key, nullptr);
+        }
         mDirty = true;
     }
     else
@@ -300,6 +347,14 @@ CHIP_ERROR ChipLinuxStorage::ClearAll()
 
     retval = ChipLinuxStorageIni::RemoveAll();
 
+    if (retval == CHIP_NO_ERROR && mLog.IsOpen())
+    {
+        // Writing the now empty configuration file also empties the log.
+        retval = CompactLogLocked();
+        mLock.unlock();
+        return retval;
+    }
+
     mLock.unlock();
 
     if (retval == CHIP_NO_ERROR)
@@ -332,6 +387,40 @@ CHIP_ERROR ChipLinuxStorage::Commit()
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
 
+    if (mLog.IsOpen())
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+
+        if (mLogFlushWindow.count() == 0)
+        {
+            return FlushLogLocked();
+        }
+
+        // Group the writes made within the flush window into a single flush. The timer can only be started from the
+        // CHIP thread, and if that is not possible yet, the writes are flushed right away.
+        if (!mLogFlushScheduled && mLog.HasPendingRecords())
+        {
+            if (!mLogFlushRequest)
+            {
+                mLogFlushRequest = Platform::MakeShared<LogFlushRequest>(this);
+            }
+
+            // The work item holds its own reference to the request, as it may run after this object is destroyed.
+            auto * request = mLogFlushRequest ? Platform::New<Platform::SharedPtr<LogFlushRequest>>(mLogFlushRequest) : nullptr;
+            if (request == nullptr)
+            {
+                return FlushLogLocked();
+            }
+            if (PlatformMgr().ScheduleWork(StartLogFlushTimer, reinterpret_cast<intptr_t>(request)) != CHIP_NO_ERROR)
+            {
+                Platform::Delete(request);
+                return FlushLogLocked();
+            }
+            mLogFlushScheduled = true;
+        }
+        return CHIP_NO_ERROR;
+    }
+
     if (mDirty && !mConfigPath.empty())
     {
         mLock.lock();
@@ -348,6 +437,77 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     return retval;
 }
 
+void ChipLinuxStorage::OnLogRecord(ChipLinuxStorageLog::RecordType type, const std::string & key, const std::string & value)
+{
+    if (type == ChipLinuxStorageLog::RecordType::kPut)
+    {
+        ChipLinuxStorageIni::AddEntry(key.c_str(), value.c_str());
+    }
+    else
+    {
+        // The key may already be missing from the configuration file if the process stopped during a compaction.
+        ChipLinuxStorageIni::RemoveEntry(key.c_str());
+    }
+}
+
+CHIP_ERROR ChipLinuxStorage::FlushLogLocked()
+{
+    ReturnErrorOnFailure(mLog.Flush());
+
+    if (mLog.Size() >= CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE)
+    {
+        // The writes are already durable in the log, so a failed compaction is only retried on the next flush.
+        CHIP_ERROR err = CompactLogLocked();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Failed to compact KVS log: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorage::CompactLogLocked()
+{
+    // The log may only be emptied once the configuration file holding all the writes is durable. If the process stops in
+    // between, replaying the log on top of the new configuration file yields the same content.
+    ReturnErrorOnFailure(ChipLinuxStorageIni::CommitConfig(mConfigPath));
+    return mLog.Truncate();
+}
+
+void ChipLinuxStorage::StartLogFlushTimer(intptr_t context)
+{
+    auto * request = reinterpret_cast<Platform::SharedPtr<LogFlushRequest> *>(context);
+    Platform::SharedPtr<LogFlushRequest> strongRequest(std::move(*request));
+    Platform::Delete(request);
+
+    // Holding the request lock keeps the storage from being destroyed until the timer is started, so that the
+    // destructor cancels it.
+    std::lock_guard<std::mutex> requestLock(strongRequest->mLock);
+    ChipLinuxStorage * storage = strongRequest->mStorage;
+    VerifyOrReturn(storage != nullptr);
+
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(storage->mLogFlushWindow, HandleLogFlushTimer, storage);
+    if (err != CHIP_NO_ERROR)
+    {
+        HandleLogFlushTimer(nullptr, storage);
+    }
+}
+
+void ChipLinuxStorage::HandleLogFlushTimer(System::Layer * systemLayer, void * context)
+{
+    auto * storage = static_cast<ChipLinuxStorage *>(context);
+
+    std::lock_guard<std::mutex> lock(storage->mLock);
+    storage->mLogFlushScheduled = false;
+
+    CHIP_ERROR err = storage->FlushLogLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to flush KVS log: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
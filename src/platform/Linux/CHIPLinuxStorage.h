@@ -28,14 +28,21 @@
  *         The ephemeral partition should be erased during factory reset.
  *
  *         ChipLinuxStorage wraps the storage class ChipLinuxStorageIni with mutex.
+ *         Writes are persisted either by rewriting the whole file, or by
+ *         appending them to a log (see ChipLinuxStorageLog) which is
+ *         periodically compacted into the file.
  *
  */
 
 #pragma once
 
+#include <lib/support/CHIPMem.h>
 #include <mutex>
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorageIni.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
 #include <string>
+#include <system/SystemLayer.h>
 
 #ifndef FATCONFDIR
 #define FATCONFDIR "/tmp"
@@ -63,13 +70,30 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-class ChipLinuxStorage : private ChipLinuxStorageIni
+class ChipLinuxStorage : private ChipLinuxStorageIni, private ChipLinuxStorageLog::Delegate
 {
 public:
+    /**
+     * How Commit() persists the writes.
+     */
+    enum class CommitMode : uint8_t
+    {
+        kRewriteFile, ///< Rewrite the whole configuration file.
+        kAppendLog,   ///< Append the writes to the "<configFile>.log" file, compacted into the configuration file when large.
+    };
+
     ChipLinuxStorage();
     ~ChipLinuxStorage();
 
-    CHIP_ERROR Init(const char * configFile);
+    /**
+     * @param logFlushWindow  In CommitMode::kAppendLog, how long the writes committed from the moment the log has pending
+     *                        writes are held before being flushed together. Zero flushes on every commit. With a
+     *                        non-zero window, the storage must be destroyed on the CHIP thread or with the CHIP stack
+     *                        locked, as it cancels its flush timer.
+     */
+    CHIP_ERROR Init(const char * configFile, CommitMode commitMode = CommitMode::kRewriteFile,
+                    System::Clock::Milliseconds32 logFlushWindow =
+                        System::Clock::Milliseconds32(CHIP_DEVICE_CONFIG_LINUX_KVS_FLUSH_WINDOW_MS));
     CHIP_ERROR ReadValue(const char * key, bool & val);
     CHIP_ERROR ReadValue(const char * key, uint16_t & val);
     CHIP_ERROR ReadValue(const char * key, uint32_t & val);
@@ -88,10 +112,34 @@ public:
     bool HasValue(const char * key);
 
 private:
+    // Handed to the work item that starts the flush timer, which may still be queued when the storage is destroyed.
+    struct LogFlushRequest
+    {
+        explicit LogFlushRequest(ChipLinuxStorage * storage) : mStorage(storage) {}
+
+        std::mutex mLock;
+        ChipLinuxStorage * mStorage; // Cleared when the storage is destroyed.
+    };
+
+    void OnLogRecord(ChipLinuxStorageLog::RecordType type, const std::string & key, const std::string & value) override;
+
+    // The following must be called with mLock held.
+    CHIP_ERROR FlushLogLocked();
+    CHIP_ERROR CompactLogLocked();
+
+    static void StartLogFlushTimer(intptr_t context);
+    static void HandleLogFlushTimer(System::Layer * systemLayer, void * context);
+
     std::mutex mLock;
     bool mDirty;
     std::string mConfigPath;
     bool mInitialized = false;
+
+    CommitMode mCommitMode = CommitMode::kRewriteFile;
+    ChipLinuxStorageLog mLog;
+    System::Clock::Milliseconds32 mLogFlushWindow = System::Clock::kZero;
+    Platform::SharedPtr<LogFlushRequest> mLogFlushRequest;
+    bool mLogFlushScheduled = false;
 };
 
 } // namespace Internal
@@ -23,7 +23,11 @@
  *
  */
 
+#include <errno.h>
+#include <fcntl.h>
 #include <fstream>
+#include <libgen.h>
+#include <string.h>
 #include <string>
 #include <unistd.h>
 
@@ -41,6 +45,21 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+namespace {
+
+void SyncParentDirectory(const std::string & path)
+{
+    std::string dirPath = path;
+    int fd              = open(dirname(&dirPath[0]), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd != -1)
+    {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+} // namespace
+
 CHIP_ERROR ChipLinuxStorageIni::Init()
 {
     return RemoveAll();
@@ -89,6 +108,7 @@ CHIP_ERROR ChipLinuxStorageIni::AddConfig(const std::string & configFile)
 // 1. Writing to a temporary file
 // 2. Sync'ing the temp file to commit updated data
 // 3. Using rename() to overwrite the existing file
+// 4. Sync'ing the directory to commit the rename
 CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
 {
     CHIP_ERROR retval   = CHIP_NO_ERROR;
@@ -103,12 +123,24 @@ CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
 
         ofs.open(tmpPath, std::ofstream::out | std::ofstream::trunc);
         mConfigStore.generate(ofs);
+        ofs.close();
+
+        if (ofs.fail() || fsync(fd) != 0)
+        {
+            ChipLogError(DeviceLayer, "failed to write (%s), %s (%d)", tmpPath.c_str(), strerror(errno), errno);
+            retval = CHIP_ERROR_WRITE_FAILED;
+        }
 
         close(fd);
 
-        if (rename(tmpPath.c_str(), configFile.c_str()) == 0)
+        if (retval != CHIP_NO_ERROR)
+        {
+            unlink(tmpPath.c_str());
+        }
+        else if (rename(tmpPath.c_str(), configFile.c_str()) == 0)
         {
             ChipLogProgress(DeviceLayer, "renamed tmp file to file (%s)", configFile.c_str());
+            SyncParentDirectory(configFile);
         }
         else
         {
@@ -0,0 +1,270 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implements the append-only journal of key-value store updates
+ *          used by ChipLinuxStorage.
+ *
+ *          Each record is laid out as follows, integers being little-endian:
+ *
+ *            uint32  length of the record body
+ *            body:
+ *              uint8   record type
+ *              uint16  key length
+ *              key
+ *              value   (the rest of the body)
+ *            uint32  CRC-32 of the length and the body
+ *
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr size_t kLengthSize     = sizeof(uint32_t);
+constexpr size_t kBodyHeaderSize = sizeof(uint8_t) + sizeof(uint16_t);
+constexpr size_t kChecksumSize   = sizeof(uint32_t);
+constexpr size_t kMaxKeySize     = UINT16_MAX;
+
+bool WriteAll(int fd, const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(fd, data, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool ReadAll(int fd, uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t readSize = read(fd, data, length);
+        if (readSize < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (readSize <= 0)
+        {
+            return false;
+        }
+        data += readSize;
+        length -= static_cast<size_t>(readSize);
+    }
+    return true;
+}
+
+} // namespace
+
+uint32_t ChipLinuxStorageLog::Checksum(const uint8_t * data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Open(const std::string & path, Delegate & delegate)
+{
+    VerifyOrReturnError(!IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    mFd = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (mFd < 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to open KVS log file (%s), %s (%d)", path.c_str(), strerror(errno), errno);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    struct stat fileStat;
+    if (fstat(mFd, &fileStat) != 0)
+    {
+        Close();
+        return CHIP_ERROR_READ_FAILED;
+    }
+
+    std::string contents(static_cast<size_t>(fileStat.st_size), '\0');
+    if (!contents.empty() && !ReadAll(mFd, reinterpret_cast<uint8_t *>(&contents[0]), contents.size()))
+    {
+        ChipLogError(DeviceLayer, "Failed to read KVS log file (%s)", path.c_str());
+        Close();
+        return CHIP_ERROR_READ_FAILED;
+    }
+
+    const uint8_t * data = reinterpret_cast<const uint8_t *>(contents.data());
+    size_t offset        = 0;
+    size_t recordCount   = 0;
+    while (contents.size() - offset >= kLengthSize + kBodyHeaderSize + kChecksumSize)
+    {
+        const uint8_t * record  = data + offset;
+        const uint32_t bodySize = Encoding::LittleEndian::Get32(record);
+        if (bodySize < kBodyHeaderSize || bodySize > contents.size() - offset - kLengthSize - kChecksumSize)
+        {
+            break;
+        }
+
+        const uint8_t * body = record + kLengthSize;
+        if (Checksum(record, kLengthSize + bodySize) != Encoding::LittleEndian::Get32(body + bodySize))
+        {
+            break;
+        }
+
+        const auto type        = static_cast<RecordType>(body[0]);
+        const uint16_t keySize = Encoding::LittleEndian::Get16(body + 1);
+        if ((type != RecordType::kPut && type != RecordType::kDelete) || keySize > bodySize - kBodyHeaderSize)
+        {
+            break;
+        }
+
+        const char * key = reinterpret_cast<const char *>(body + kBodyHeaderSize);
+        delegate.OnLogRecord(type, std::string(key, keySize), std::string(key + keySize, bodySize - kBodyHeaderSize - keySize));
+
+        offset += kLengthSize + bodySize + kChecksumSize;
+        recordCount++;
+    }
+
+    if (offset != contents.size())
+    {
+        // Anything past the last valid record is the remains of an interrupted append.
+        ChipLogError(DeviceLayer, "Dropping %u trailing bytes of KVS log file (%s)",
+                     static_cast<unsigned>(contents.size() - offset), path.c_str());
+        if (ftruncate(mFd, static_cast<off_t>(offset)) != 0 || fdatasync(mFd) != 0)
+        {
+            Close();
+            return CHIP_ERROR_WRITE_FAILED;
+        }
+    }
+
+    ChipLogDetail(DeviceLayer, "Replayed %u records from KVS log file (%s)", static_cast<unsigned>(recordCount), path.c_str());
+    mSize = offset;
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::Close()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mSize = 0;
+    mPendingRecords.clear();
+}
+
+bool ChipLinuxStorageLog::CanAppend(const char * key, const char * value)
+{
+    const size_t keySize   = strnlen(key, kMaxKeySize + 1);
+    const size_t valueSize = (value != nullptr) ? strlen(value) : 0;
+    return (keySize <= kMaxKeySize) && (valueSize <= UINT32_MAX - kBodyHeaderSize - kMaxKeySize);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Append(RecordType type, const char * key, const char * value)
+{
+    VerifyOrReturnError(CanAppend(key, value), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t keySize   = strlen(key);
+    const size_t valueSize = (value != nullptr) ? strlen(value) : 0;
+    const size_t bodySize  = kBodyHeaderSize + keySize + valueSize;
+    const size_t start     = mPendingRecords.size();
+
+    mPendingRecords.resize(start + kLengthSize + bodySize + kChecksumSize);
+    uint8_t * record = reinterpret_cast<uint8_t *>(&mPendingRecords[start]);
+    uint8_t * body   = record + kLengthSize;
+
+    Encoding::LittleEndian::Put32(record, static_cast<uint32_t>(bodySize));
+    body[0] = static_cast<uint8_t>(type);
+    Encoding::LittleEndian::Put16(body + 1, static_cast<uint16_t>(keySize));
+    memcpy(body + kBodyHeaderSize, key, keySize);
+    if (valueSize > 0)
+    {
+        memcpy(body + kBodyHeaderSize + keySize, value, valueSize);
+    }
+    Encoding::LittleEndian::Put32(body + bodySize, Checksum(record, kLengthSize + bodySize));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Flush()
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(HasPendingRecords(), CHIP_NO_ERROR);
+
+    if (!WriteAll(mFd, reinterpret_cast<const uint8_t *>(mPendingRecords.data()), mPendingRecords.size()) ||
+        fdatasync(mFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to write KVS log file, %s (%d)", strerror(errno), errno);
+
+        // Drop a partially written record, so that records appended by a later flush are not hidden behind it.
+        if (ftruncate(mFd, static_cast<off_t>(mSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS log file, %s (%d)", strerror(errno), errno);
+        }
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    mSize += mPendingRecords.size();
+    mPendingRecords.clear();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Truncate()
+{
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    mPendingRecords.clear();
+    if (ftruncate(mFd, 0) != 0 || fdatasync(mFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to truncate KVS log file, %s (%d)", strerror(errno), errno);
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+    mSize = 0;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
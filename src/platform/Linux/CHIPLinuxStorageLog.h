@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an append-only journal of key-value store updates, used by
+ *          ChipLinuxStorage to persist individual writes without rewriting
+ *          the whole configuration file.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ * An append-only log of key-value store updates.
+ *
+ * Each record holds one update: a key and its new value, or a key removal. Records are checksummed, so that a record
+ * left incomplete by a crash or power loss in the middle of an append is detected and dropped when the log is opened,
+ * along with anything that follows it.
+ *
+ * Records are first added to a pending buffer, and only written to the file by Flush(), so that several updates can be
+ * made durable with a single write and sync.
+ */
+class ChipLinuxStorageLog
+{
+public:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called by Open() for each valid record found in the log, in the order the records were appended.
+         */
+        virtual void OnLogRecord(RecordType type, const std::string & key, const std::string & value) = 0;
+    };
+
+    ChipLinuxStorageLog() = default;
+    ~ChipLinuxStorageLog() { Close(); }
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * Open the log file, creating it if needed, and replay its valid records to the delegate.
+     *
+     * Anything following the last valid record is truncated, so that new records are appended right after it.
+     */
+    CHIP_ERROR Open(const std::string & path, Delegate & delegate);
+    void Close();
+    bool IsOpen() const { return mFd >= 0; }
+
+    /**
+     * Whether a record for the given key and value fits the record format. Keys are limited to UINT16_MAX bytes.
+     */
+    static bool CanAppend(const char * key, const char * value);
+
+    /**
+     * Add a record to the pending buffer. It is only written to the file by the next Flush().
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  The record does not fit the record format (see CanAppend), nothing was added.
+     */
+    CHIP_ERROR Append(RecordType type, const char * key, const char * value);
+
+    bool HasPendingRecords() const { return !mPendingRecords.empty(); }
+
+    /**
+     * Write the pending records to the file with a single write, and sync the file.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * Discard all the records, pending or written. This must only be called once the state described by the records has
+     * been durably saved elsewhere.
+     */
+    CHIP_ERROR Truncate();
+
+    /**
+     * Returns the size of the records written to the file.
+     */
+    size_t Size() const { return mSize; }
+
+    /**
+     * Returns the CRC-32 (as used by IEEE 802.3 and zlib) of the given data, which ends each record.
+     */
+    static uint32_t Checksum(const uint8_t * data, size_t length);
+
+private:
+    int mFd      = -1;
+    size_t mSize = 0;
+    std::string mPendingRecords;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
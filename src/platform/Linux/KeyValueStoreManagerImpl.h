@@ -36,7 +36,14 @@ public:
      * @brief
      * Initalize the KVS, must be called before using.
      */
-    CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
+    CHIP_ERROR Init(const char * file)
+    {
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_APPEND_LOG
+        return mStorage.Init(file, DeviceLayer::Internal::ChipLinuxStorage::CommitMode::kAppendLog);
+#else
+        return mStorage.Init(file);
+#endif
+    }
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
@@ -0,0 +1,424 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the Linux key-value
+ *      storage log, and for the storage committing writes to it.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#include <platform/TestOnlyCommissionableDataProvider.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+using RecordType = ChipLinuxStorageLog::RecordType;
+using CommitMode = ChipLinuxStorage::CommitMode;
+
+// Collects the content described by the records replayed from a log.
+class RecordCollector : public ChipLinuxStorageLog::Delegate
+{
+public:
+    void OnLogRecord(RecordType type, const std::string & key, const std::string & value) override
+    {
+        if (type == RecordType::kPut)
+        {
+            mValues[key] = value;
+        }
+        else
+        {
+            mValues.erase(key);
+        }
+        mRecordCount++;
+    }
+
+    std::map<std::string, std::string> mValues;
+    size_t mRecordCount = 0;
+};
+
+size_t FileSize(const std::string & path)
+{
+    struct stat fileStat;
+    return (stat(path.c_str(), &fileStat) == 0) ? static_cast<size_t>(fileStat.st_size) : 0;
+}
+
+std::string ReadFile(const std::string & path)
+{
+    std::ifstream ifs(path, std::ifstream::binary);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const std::string & path, const std::string & contents)
+{
+    std::ofstream ofs(path, std::ofstream::binary | std::ofstream::trunc);
+    ofs << contents;
+}
+
+std::string ReadString(ChipLinuxStorage & storage, const char * key)
+{
+    char buf[64];
+    size_t length = 0;
+    return (storage.ReadValueStr(key, buf, sizeof(buf), length) == CHIP_NO_ERROR) ? std::string(buf, length) : std::string();
+}
+
+void StopEventLoop(System::Layer *, void *)
+{
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+}
+
+// Runs the CHIP event loop on this thread for the given time.
+void RunEventLoopFor(System::Clock::Milliseconds32 duration)
+{
+    PlatformMgr().LockChipStack();
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(duration, StopEventLoop, nullptr);
+    PlatformMgr().UnlockChipStack();
+
+    ASSERT_EQ(err, CHIP_NO_ERROR);
+    PlatformMgr().RunEventLoop();
+}
+
+class TestLinuxStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+
+        // Set up a fake commissionable data provider since required by internals of several
+        // Device/SystemLayer components.
+        static chip::DeviceLayer::TestOnlyCommissionableDataProvider commissionable_data_provider;
+        chip::DeviceLayer::SetCommissionableDataProvider(&commissionable_data_provider);
+    }
+
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dir[] = "/tmp/chip-linux-storage-XXXXXX";
+        ASSERT_NE(mkdtemp(dir), nullptr);
+        mDir        = dir;
+        mConfigPath = mDir + "/config.ini";
+        mLogPath    = mConfigPath + ".log";
+    }
+
+    void TearDown() override
+    {
+        unlink(mLogPath.c_str());
+        unlink(mConfigPath.c_str());
+        rmdir(mDir.c_str());
+    }
+
+    std::string mDir;
+    std::string mConfigPath;
+    std::string mLogPath;
+};
+
+TEST_F(TestLinuxStorage, TestChecksum)
+{
+    const char kCheckInput[] = "123456789";
+
+    EXPECT_EQ(ChipLinuxStorageLog::Checksum(nullptr, 0), 0u);
+    EXPECT_EQ(ChipLinuxStorageLog::Checksum(reinterpret_cast<const uint8_t *>(kCheckInput), sizeof(kCheckInput) - 1),
+              0xCBF43926u);
+}
+
+TEST_F(TestLinuxStorage, TestLogReplay)
+{
+    {
+        ChipLinuxStorageLog log;
+        RecordCollector collector;
+        ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+        EXPECT_EQ(collector.mRecordCount, 0u);
+
+        EXPECT_EQ(log.Append(RecordType::kPut, "a", "1"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kPut, "b", "2"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kDelete, "a", nullptr), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kPut, "b", "3"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kPut, "empty", ""), CHIP_NO_ERROR);
+
+        // Nothing reaches the file until the records are flushed.
+        EXPECT_TRUE(log.HasPendingRecords());
+        EXPECT_EQ(log.Size(), 0u);
+        EXPECT_EQ(FileSize(mLogPath), 0u);
+
+        EXPECT_EQ(log.Flush(), CHIP_NO_ERROR);
+        EXPECT_FALSE(log.HasPendingRecords());
+        EXPECT_EQ(log.Size(), FileSize(mLogPath));
+    }
+
+    ChipLinuxStorageLog log;
+    RecordCollector collector;
+    ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+    EXPECT_EQ(collector.mRecordCount, 5u);
+    EXPECT_EQ(collector.mValues, (std::map<std::string, std::string>{ { "b", "3" }, { "empty", "" } }));
+    EXPECT_EQ(log.Size(), FileSize(mLogPath));
+}
+
+TEST_F(TestLinuxStorage, TestLogTornTail)
+{
+    size_t recordEnds[3];
+    {
+        ChipLinuxStorageLog log;
+        RecordCollector collector;
+        ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+
+        const char * values[] = { "first", "second", "third" };
+        for (size_t i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(log.Append(RecordType::kPut, "key", values[i]), CHIP_NO_ERROR);
+            EXPECT_EQ(log.Flush(), CHIP_NO_ERROR);
+            recordEnds[i] = log.Size();
+        }
+    }
+    const std::string contents = ReadFile(mLogPath);
+    ASSERT_EQ(contents.size(), recordEnds[2]);
+
+    // Cut the last record at every offset, as an interrupted append would: only the first two records are recovered,
+    // and the torn record is dropped from the file.
+    for (size_t cut = recordEnds[1] + 1; cut < recordEnds[2]; cut++)
+    {
+        WriteFile(mLogPath, contents.substr(0, cut));
+
+        ChipLinuxStorageLog log;
+        RecordCollector collector;
+        ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+        EXPECT_EQ(collector.mRecordCount, 2u);
+        EXPECT_EQ(collector.mValues["key"], "second");
+        EXPECT_EQ(log.Size(), recordEnds[1]);
+        EXPECT_EQ(FileSize(mLogPath), recordEnds[1]);
+    }
+
+    // Records appended after a recovery follow the last valid record.
+    {
+        ChipLinuxStorageLog log;
+        RecordCollector collector;
+        ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kPut, "key", "fourth"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Flush(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog log;
+    RecordCollector collector;
+    ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+    EXPECT_EQ(collector.mRecordCount, 3u);
+    EXPECT_EQ(collector.mValues["key"], "fourth");
+}
+
+TEST_F(TestLinuxStorage, TestLogCorruptRecord)
+{
+    size_t firstRecordEnd = 0;
+    {
+        ChipLinuxStorageLog log;
+        RecordCollector collector;
+        ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+
+        EXPECT_EQ(log.Append(RecordType::kPut, "a", "1"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Flush(), CHIP_NO_ERROR);
+        firstRecordEnd = log.Size();
+
+        EXPECT_EQ(log.Append(RecordType::kPut, "b", "2"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Append(RecordType::kPut, "c", "3"), CHIP_NO_ERROR);
+        EXPECT_EQ(log.Flush(), CHIP_NO_ERROR);
+    }
+
+    // Flip a bit in the value of the second record: its checksum no longer matches, and it is dropped along with
+    // everything that follows it.
+    std::string contents = ReadFile(mLogPath);
+    contents[firstRecordEnd + 7] ^= 0x01;
+    WriteFile(mLogPath, contents);
+
+    ChipLinuxStorageLog log;
+    RecordCollector collector;
+    ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+    EXPECT_EQ(collector.mValues, (std::map<std::string, std::string>{ { "a", "1" } }));
+    EXPECT_EQ(FileSize(mLogPath), firstRecordEnd);
+}
+
+TEST_F(TestLinuxStorage, TestStorageReplay)
+{
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+
+        EXPECT_EQ(storage.WriteValueStr("a", "1"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("b", "2"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValue("c", static_cast<uint32_t>(3)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("a"), CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    // The writes only went to the log: the configuration file was not rewritten.
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kRewriteFile), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.HasValue("b"));
+    }
+
+    const size_t logSize = FileSize(mLogPath);
+    EXPECT_GT(logSize, 0u);
+
+    // Lose the tail of the last record, as if the process had stopped while appending it.
+    ASSERT_EQ(truncate(mLogPath.c_str(), static_cast<off_t>(logSize - 1)), 0);
+
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("a"));
+    EXPECT_EQ(ReadString(storage, "b"), "2");
+    EXPECT_FALSE(storage.HasValue("c"));
+}
+
+TEST_F(TestLinuxStorage, TestStorageCompaction)
+{
+    uint8_t blob[4096];
+    memset(blob, 0x5a, sizeof(blob));
+
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueStr("a", "1"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+    // Write until the log grows past the compaction size and is emptied into the configuration file.
+    bool compacted = false;
+    char key[16];
+    for (size_t i = 0; !compacted && i <= CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_SIZE / sizeof(blob); i++)
+    {
+        snprintf(key, sizeof(key), "blob%u", static_cast<unsigned>(i));
+        EXPECT_EQ(storage.WriteValueBin(key, blob, sizeof(blob)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        compacted = (FileSize(mLogPath) == 0);
+    }
+    ASSERT_TRUE(compacted);
+
+    // Writes made after the compaction go to the log again.
+    EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    EXPECT_GT(FileSize(mLogPath), 0u);
+
+    {
+        ChipLinuxStorage configOnly;
+        ASSERT_EQ(configOnly.Init(mConfigPath.c_str(), CommitMode::kRewriteFile), CHIP_NO_ERROR);
+        EXPECT_TRUE(configOnly.HasValue("a"));
+        EXPECT_TRUE(configOnly.HasValue(key));
+    }
+
+    ChipLinuxStorage reopened;
+    ASSERT_EQ(reopened.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+    EXPECT_FALSE(reopened.HasValue("a"));
+    EXPECT_TRUE(reopened.HasValue("blob0"));
+    EXPECT_TRUE(reopened.HasValue(key));
+}
+
+TEST_F(TestLinuxStorage, TestStorageCompactionInterrupted)
+{
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+
+        EXPECT_EQ(storage.WriteValueStr("a", "1"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("b", "2"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("b", "3"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("c", "4"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    // Stop a compaction between its two steps: the configuration file holds the content described by the log, but
+    // the log was not emptied yet.
+    {
+        ChipLinuxStorage storage;
+        ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kRewriteFile), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("b", "3"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueStr("c", "4"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+    EXPECT_GT(FileSize(mLogPath), 0u);
+
+    // Replaying the log on top of the configuration file yields the same content, including the removal of a key
+    // that the configuration file no longer holds.
+    ChipLinuxStorage storage;
+    ASSERT_EQ(storage.Init(mConfigPath.c_str(), CommitMode::kAppendLog, System::Clock::kZero), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("a"));
+    EXPECT_EQ(ReadString(storage, "b"), "3");
+    EXPECT_EQ(ReadString(storage, "c"), "4");
+}
+
+TEST_F(TestLinuxStorage, TestStorageFlushWindow)
+{
+    constexpr System::Clock::Milliseconds32 kFlushWindow(50);
+
+    ASSERT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    auto * storage = chip::Platform::New<ChipLinuxStorage>();
+    ASSERT_NE(storage, nullptr);
+    ASSERT_EQ(storage->Init(mConfigPath.c_str(), CommitMode::kAppendLog, kFlushWindow), CHIP_NO_ERROR);
+
+    // The writes committed within the window are held, and then flushed together by the CHIP thread.
+    EXPECT_EQ(storage->WriteValueStr("a", "1"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage->Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage->WriteValueStr("b", "2"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage->Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(mLogPath), 0u);
+
+    RunEventLoopFor(kFlushWindow * 4);
+    const size_t flushedSize = FileSize(mLogPath);
+    EXPECT_GT(flushedSize, 0u);
+
+    // Writes still held when the storage is destroyed are flushed by the destructor, and the queued start of the flush
+    // timer must then do nothing.
+    EXPECT_EQ(storage->WriteValueStr("c", "3"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage->Commit(), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(mLogPath), flushedSize);
+
+    PlatformMgr().LockChipStack();
+    chip::Platform::Delete(storage);
+    PlatformMgr().UnlockChipStack();
+
+    RunEventLoopFor(kFlushWindow * 4);
+
+    PlatformMgr().Shutdown();
+
+    ChipLinuxStorageLog log;
+    RecordCollector collector;
+    ASSERT_EQ(log.Open(mLogPath, collector), CHIP_NO_ERROR);
+    EXPECT_EQ(collector.mValues, (std::map<std::string, std::string>{ { "a", "1" }, { "b", "2" }, { "c", "3" } }));
+}
+
+} // namespace
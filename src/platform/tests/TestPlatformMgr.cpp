@@ -129,6 +129,60 @@ TEST_F(TestPlatformMgr, BasicEventLoopTask)
     PlatformMgr().Shutdown();
 }
 
+static std::atomic<int> backgroundWorkRun{ 0 };
+static std::atomic<int> backgroundWorkRunning{ 0 };
+static std::atomic<int> backgroundWorkMaxRunning{ 0 };
+static std::atomic<int> afterBackgroundWorkRun{ 0 };
+
+static void AfterBackgroundWork(intptr_t)
+{
+    afterBackgroundWorkRun++;
+}
+
+static void BackgroundWork(intptr_t)
+{
+    int running    = ++backgroundWorkRunning;
+    int maxRunning = backgroundWorkMaxRunning;
+    while (running > maxRunning && !backgroundWorkMaxRunning.compare_exchange_weak(maxRunning, running))
+    {
+    }
+
+    chip::test_utils::SleepMillis(20);
+
+    backgroundWorkRunning--;
+    backgroundWorkRun++;
+    (void) PlatformMgr().ScheduleWork(AfterBackgroundWork);
+}
+
+TEST_F(TestPlatformMgr, ScheduleBackgroundWork)
+{
+    constexpr int kWorkCount = 8;
+
+    backgroundWorkRun        = 0;
+    backgroundWorkMaxRunning = 0;
+    afterBackgroundWorkRun   = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    for (int i = 0; i < kWorkCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(BackgroundWork), CHIP_NO_ERROR);
+    }
+
+    // Wait for the work scheduled back on the event loop by each background work.
+    for (size_t t = 0; afterBackgroundWorkRun != kWorkCount && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(backgroundWorkRun, kWorkCount);
+    EXPECT_EQ(afterBackgroundWorkRun, kWorkCount);
+    EXPECT_LE(backgroundWorkMaxRunning, CHIP_DEVICE_CONFIG_BG_TASK_COUNT);
+
+    PlatformMgr().Shutdown();
+}
+
 static bool stopRan;
 static CHIP_ERROR stopResult = CHIP_NO_ERROR;
 
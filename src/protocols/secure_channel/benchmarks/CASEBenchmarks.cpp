@@ -0,0 +1,533 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for CASE session establishment: CASESession initiators establishing sessions with a CASEServer
+ *      over the loopback transport, with full Sigma handshakes and with session resumption.
+ */
+
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <crypto/OperationalKeystore.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/benchmark/Benchmark.h>
+#include <messaging/tests/MessagingContext.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/CASESession.h>
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+
+#include <credentials/tests/CHIPCert_test_vectors.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+using namespace chip::Messaging;
+using namespace chip::TestCerts;
+
+// Upper bound on the time a single benchmark step may take before it is considered stuck.
+constexpr System::Clock::Timeout kIterationTimeout = System::Clock::Seconds16(10);
+
+constexpr uint32_t kFullHandshakeIterations       = 100;
+constexpr uint32_t kResumptionHandshakeIterations = 200;
+constexpr uint32_t kConcurrentRounds              = 10;
+
+// Every in-flight handshake holds an unauthenticated session and an exchange on both sides of the loopback
+// transport, and both sides share the pools of a single SessionManager and ExchangeManager. Concurrency levels that
+// would exhaust them are skipped; raise the pool sizes in the project config to measure higher levels.
+constexpr size_t kMaxConcurrentInitiators =
+    std::min<size_t>(CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE - 2, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2 - 1);
+constexpr size_t kConcurrentInitiatorCounts[] = { 1, 2, 4, 16 };
+
+constexpr NodeId kResponderNodeId = 0xDEDEDEDE00010001;
+
+/**
+ * Operational keystore holding the operational key of the responder, for a single fabric.
+ */
+class TestOperationalKeystore : public OperationalKeystore
+{
+public:
+    void Init(FabricIndex fabricIndex, Platform::UniquePtr<P256Keypair> keypair)
+    {
+        mSingleFabricIndex = fabricIndex;
+        mKeypair           = std::move(keypair);
+    }
+    void Shutdown()
+    {
+        mSingleFabricIndex = kUndefinedFabricIndex;
+        mKeypair           = nullptr;
+    }
+
+    bool HasPendingOpKeypair() const override { return false; }
+    bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override { return mSingleFabricIndex != kUndefinedFabricIndex; }
+
+    CHIP_ERROR NewOpKeypairForFabric(FabricIndex fabricIndex, MutableByteSpan & outCertificateSigningRequest) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    CHIP_ERROR ActivateOpKeypairForFabric(FabricIndex fabricIndex, const P256PublicKey & nocPublicKey) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR CommitOpKeypairForFabric(FabricIndex fabricIndex) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR RemoveOpKeypairForFabric(FabricIndex fabricIndex) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    void RevertPendingKeypair() override {}
+
+    CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
+                                 P256ECDSASignature & outSignature) const override
+    {
+        VerifyOrReturnError(mKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(fabricIndex == mSingleFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
+        return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+    }
+
+    P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<P256Keypair>(); }
+
+    void ReleaseEphemeralKeypair(P256Keypair * keypair) override { Platform::Delete<P256Keypair>(keypair); }
+
+private:
+    Platform::UniquePtr<P256Keypair> mKeypair;
+    FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+};
+
+FabricTable gInitiatorFabrics;
+FabricIndex gInitiatorFabricIndex;
+GroupDataProviderImpl gInitiatorGroupDataProvider;
+TestPersistentStorageDelegate gInitiatorStorageDelegate;
+DefaultSessionKeystore gInitiatorSessionKeystore;
+PersistentStorageOpCertStore gInitiatorOpCertStore;
+TestPersistentStorageDelegate gInitiatorResumptionStorageDelegate;
+SimpleSessionResumptionStorage gInitiatorResumptionStorage;
+
+FabricTable gResponderFabrics;
+FabricIndex gResponderFabricIndex;
+GroupDataProviderImpl gResponderGroupDataProvider;
+TestPersistentStorageDelegate gResponderStorageDelegate;
+DefaultSessionKeystore gResponderSessionKeystore;
+PersistentStorageOpCertStore gResponderOpCertStore;
+TestOperationalKeystore gResponderOperationalKeystore;
+TestPersistentStorageDelegate gResponderResumptionStorageDelegate;
+SimpleSessionResumptionStorage gResponderResumptionStorage;
+
+CASEServer gCASEServer;
+
+CHIP_ERROR InitFabricTable(FabricTable & fabricTable, TestPersistentStorageDelegate & storage, OperationalKeystore * opKeyStore,
+                           PersistentStorageOpCertStore & opCertStore)
+{
+    ReturnErrorOnFailure(opCertStore.Init(&storage));
+
+    FabricTable::InitParams initParams;
+    initParams.storage             = &storage;
+    initParams.operationalKeystore = opKeyStore;
+    initParams.opCertStore         = &opCertStore;
+
+    return fabricTable.Init(initParams);
+}
+
+CHIP_ERROR InitGroupDataProvider(GroupDataProviderImpl & groupDataProvider, TestPersistentStorageDelegate & storage,
+                                 DefaultSessionKeystore & sessionKeystore)
+{
+    groupDataProvider.SetStorageDelegate(&storage);
+    groupDataProvider.SetSessionKeystore(&sessionKeystore);
+    return groupDataProvider.Init();
+}
+
+CHIP_ERROR InitIpk(GroupDataProvider & groupDataProvider, const FabricTable & fabricTable, FabricIndex fabricIndex)
+{
+    const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+    GroupDataProvider::KeySet ipkKeySet(GroupDataProvider::kIdentityProtectionKeySetId,
+                                        GroupDataProvider::SecurityPolicy::kTrustFirst, 1);
+    ipkKeySet.epoch_keys[0].start_time = 0;
+    memset(&ipkKeySet.epoch_keys[0].key, 0, sizeof(ipkKeySet.epoch_keys[0].key));
+
+    uint8_t compressedId[sizeof(uint64_t)];
+    MutableByteSpan compressedIdSpan(compressedId);
+    ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedIdSpan));
+    return groupDataProvider.SetKeySet(fabricIndex, compressedIdSpan, ipkKeySet);
+}
+
+CHIP_ERROR SerializeKeypair(const ByteSpan & publicKey, const ByteSpan & privateKey, P256SerializedKeypair & serializedKeypair)
+{
+    VerifyOrReturnError(publicKey.size() + privateKey.size() <= serializedKeypair.Capacity(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(serializedKeypair.Bytes(), publicKey.data(), publicKey.size());
+    memcpy(serializedKeypair.Bytes() + publicKey.size(), privateKey.data(), privateKey.size());
+    return serializedKeypair.SetLength(publicKey.size() + privateKey.size());
+}
+
+/**
+ * Set up two nodes of the same fabric: the initiator (Node01_02), whose operational key lives in its fabric table,
+ * and the responder (Node01_01), whose operational key lives in an operational keystore.
+ */
+CHIP_ERROR InitCredentials()
+{
+    ReturnErrorOnFailure(InitFabricTable(gInitiatorFabrics, gInitiatorStorageDelegate, nullptr, gInitiatorOpCertStore));
+    ReturnErrorOnFailure(InitGroupDataProvider(gInitiatorGroupDataProvider, gInitiatorStorageDelegate, gInitiatorSessionKeystore));
+    {
+        P256SerializedKeypair opKeysSerialized;
+        ReturnErrorOnFailure(SerializeKeypair(sTestCert_Node01_02_PublicKey, sTestCert_Node01_02_PrivateKey, opKeysSerialized));
+        ReturnErrorOnFailure(gInitiatorFabrics.AddNewFabricForTest(
+            ByteSpan(sTestCert_Root01_Chip), ByteSpan(sTestCert_ICA01_Chip), ByteSpan(sTestCert_Node01_02_Chip),
+            ByteSpan(opKeysSerialized.ConstBytes(), opKeysSerialized.Length()), &gInitiatorFabricIndex));
+    }
+    ReturnErrorOnFailure(InitIpk(gInitiatorGroupDataProvider, gInitiatorFabrics, gInitiatorFabricIndex));
+
+    ReturnErrorOnFailure(InitGroupDataProvider(gResponderGroupDataProvider, gResponderStorageDelegate, gResponderSessionKeystore));
+    {
+        P256SerializedKeypair opKeysSerialized;
+        ReturnErrorOnFailure(SerializeKeypair(sTestCert_Node01_01_PublicKey, sTestCert_Node01_01_PrivateKey, opKeysSerialized));
+
+        auto opKey = Platform::MakeUnique<P256Keypair>();
+        VerifyOrReturnError(opKey != nullptr, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(opKey->Deserialize(opKeysSerialized));
+        gResponderOperationalKeystore.Init(1, std::move(opKey));
+
+        ReturnErrorOnFailure(
+            InitFabricTable(gResponderFabrics, gResponderStorageDelegate, &gResponderOperationalKeystore, gResponderOpCertStore));
+        ReturnErrorOnFailure(gResponderFabrics.AddNewFabricForTest(ByteSpan(sTestCert_Root01_Chip), ByteSpan(sTestCert_ICA01_Chip),
+                                                                   ByteSpan(sTestCert_Node01_01_Chip), ByteSpan{},
+                                                                   &gResponderFabricIndex));
+    }
+    ReturnErrorOnFailure(InitIpk(gResponderGroupDataProvider, gResponderFabrics, gResponderFabricIndex));
+
+    ReturnErrorOnFailure(gInitiatorResumptionStorage.Init(&gInitiatorResumptionStorageDelegate));
+    return gResponderResumptionStorage.Init(&gResponderResumptionStorageDelegate);
+}
+
+class CASEBenchmarks;
+
+/**
+ * One CASE initiator, establishing sessions with the responder one after the other.
+ */
+class Initiator : public SessionEstablishmentDelegate
+{
+public:
+    enum class State : uint8_t
+    {
+        kIdle,
+        kPending,
+        kBusy,
+        kEstablished,
+        kFailed,
+    };
+
+    CHIP_ERROR Start(CASEBenchmarks & context, SessionResumptionStorage * resumptionStorage);
+    void Reset();
+
+    void OnSessionEstablishmentError(CHIP_ERROR error) override
+    {
+        mError = error;
+        mState = (error == CHIP_ERROR_BUSY) ? State::kBusy : State::kFailed;
+        if (mState == State::kBusy)
+        {
+            mBusyCount++;
+        }
+    }
+
+    void OnSessionEstablished(const SessionHandle & session) override
+    {
+        mLatency = System::SystemClock().GetMonotonicMicroseconds64() - mStartTime;
+        mResumed = mCASESession->GetState() == CASESession::State::kFinishedViaResume;
+        mState   = State::kEstablished;
+    }
+
+    State GetState() const { return mState; }
+    bool IsSettled() const { return mState != State::kPending; }
+
+    System::Clock::Microseconds64 mLatency;
+    bool mResumed       = false;
+    uint32_t mBusyCount = 0;
+    CHIP_ERROR mError   = CHIP_NO_ERROR;
+
+private:
+    std::unique_ptr<CASESession> mCASESession;
+    State mState = State::kIdle;
+    System::Clock::Microseconds64 mStartTime;
+};
+
+class CASEBenchmarks : public chip::Test::LoopbackMessagingContext
+{
+public:
+    static void SetUpTestSuite()
+    {
+        LoopbackMessagingContext::SetUpTestSuite();
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+        ASSERT_EQ(InitCredentials(), CHIP_NO_ERROR);
+        DeviceLayer::SetSystemLayerForTesting(&GetSystemLayer());
+    }
+
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        gResponderOperationalKeystore.Shutdown();
+        gInitiatorFabrics.DeleteAllFabrics();
+        gResponderFabrics.DeleteAllFabrics();
+        gInitiatorGroupDataProvider.Finish();
+        gResponderGroupDataProvider.Finish();
+        DeviceLayer::PlatformMgr().Shutdown();
+        LoopbackMessagingContext::TearDownTestSuite();
+    }
+
+    void SetUp() override
+    {
+        ConfigInitializeNodes(false);
+        LoopbackMessagingContext::SetUp();
+
+        gInitiatorResumptionStorageDelegate.ClearStorage();
+        gResponderResumptionStorageDelegate.ClearStorage();
+        ASSERT_EQ(gCASEServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gResponderFabrics,
+                                                            &gResponderResumptionStorage, nullptr, &gResponderGroupDataProvider),
+                  CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        gCASEServer.Shutdown();
+        LoopbackMessagingContext::TearDown();
+    }
+
+protected:
+    // Parts of the handshake (e.g. Sigma3 validation) run as background work, which completes through the
+    // platform event queue, so run the platform event loop rather than only the IO loop. Each pass returns
+    // as soon as the pending timers and events are handled, so no iteration waits for the loop to go idle.
+    template <typename Predicate>
+    bool ServiceUntil(Predicate && done)
+    {
+        System::Clock::Timestamp deadline = System::SystemClock().GetMonotonicTimestamp() + kIterationTimeout;
+        while (!done())
+        {
+            if (System::SystemClock().GetMonotonicTimestamp() >= deadline)
+            {
+                return false;
+            }
+            DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { DeviceLayer::PlatformMgr().StopEventLoopTask(); });
+            DeviceLayer::PlatformMgr().RunEventLoop();
+        }
+        return true;
+    }
+
+    // Drop the sessions established by the previous handshakes, as a controller would once done with a node, so that
+    // the session table does not fill up over the iterations. Resumption records are kept.
+    void ExpireSessions()
+    {
+        GetSecureSessionManager().ExpireAllSessionsForFabric(gInitiatorFabricIndex);
+        GetSecureSessionManager().ExpireAllSessionsForFabric(gResponderFabricIndex);
+    }
+
+    bool RunHandshake(Initiator & initiator, SessionResumptionStorage * resumptionStorage);
+    void RunSequential(const char * name, uint32_t iterations, SessionResumptionStorage * resumptionStorage);
+    void RunConcurrent(size_t initiatorCount);
+};
+
+CHIP_ERROR Initiator::Start(CASEBenchmarks & context, SessionResumptionStorage * resumptionStorage)
+{
+    if (mState != State::kBusy)
+    {
+        // Initiators turned away by a busy responder keep their start time: the latency of their handshake
+        // includes the time spent waiting for the responder.
+        mStartTime = System::SystemClock().GetMonotonicMicroseconds64();
+    }
+
+    mCASESession = std::make_unique<CASESession>();
+    mCASESession->SetGroupDataProvider(&gInitiatorGroupDataProvider);
+
+    ExchangeContext * exchange = context.NewUnauthenticatedExchangeToBob(mCASESession.get());
+    VerifyOrReturnError(exchange != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mState = State::kPending;
+    return mCASESession->EstablishSession(context.GetSecureSessionManager(), &gInitiatorFabrics,
+                                          ScopedNodeId{ kResponderNodeId, gInitiatorFabricIndex }, exchange, resumptionStorage,
+                                          nullptr, this, Optional<ReliableMessageProtocolConfig>::Missing());
+}
+
+void Initiator::Reset()
+{
+    mCASESession.reset();
+    mState   = State::kIdle;
+    mResumed = false;
+    mError   = CHIP_NO_ERROR;
+}
+
+bool CASEBenchmarks::RunHandshake(Initiator & initiator, SessionResumptionStorage * resumptionStorage)
+{
+    initiator.Reset();
+    EXPECT_EQ(initiator.Start(*this, resumptionStorage), CHIP_NO_ERROR);
+    bool settled = ServiceUntil([&]() { return initiator.IsSettled(); });
+    EXPECT_TRUE(settled);
+    EXPECT_EQ(initiator.GetState(), Initiator::State::kEstablished);
+    return settled && initiator.GetState() == Initiator::State::kEstablished;
+}
+
+void CASEBenchmarks::RunSequential(const char * name, uint32_t iterations, SessionResumptionStorage * resumptionStorage)
+{
+    Initiator initiator;
+    std::vector<System::Clock::Microseconds64> latencies;
+    latencies.reserve(iterations);
+    uint32_t resumedCount = 0;
+
+    // Warm up pools and caches outside of the measured loop. With resumption, this also stores the resumption
+    // state that the measured handshakes resume.
+    ASSERT_TRUE(RunHandshake(initiator, resumptionStorage));
+    ExpireSessions();
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        if (!RunHandshake(initiator, resumptionStorage))
+        {
+            return;
+        }
+        latencies.push_back(initiator.mLatency);
+        resumedCount += initiator.mResumed ? 1 : 0;
+        ExpireSessions();
+    }
+    initiator.Reset();
+
+    // All the measured time and CPU is spent on handshakes, both sides of which run in this process.
+    Benchmark::Result & result = Benchmark::RecordResult(name, iterations, stopwatch, iterations);
+    result.AddCounter("cpu_us_per_handshake", static_cast<double>(result.cpuTime.count()) / iterations)
+        .AddCounter("p50_us", static_cast<double>(Benchmark::Percentile(latencies, 50).count()))
+        .AddCounter("p90_us", static_cast<double>(Benchmark::Percentile(latencies, 90).count()))
+        .AddCounter("p99_us", static_cast<double>(Benchmark::Percentile(latencies, 99).count()))
+        .AddCounter("resumption_hit_rate", static_cast<double>(resumedCount) / iterations);
+
+    // Resumption silently falls back to a full handshake on any mismatch, which would skew the comparison.
+    EXPECT_EQ(resumedCount, (resumptionStorage != nullptr) ? iterations : 0u);
+}
+
+void CASEBenchmarks::RunConcurrent(size_t initiatorCount)
+{
+    std::vector<Initiator> initiators(initiatorCount);
+    std::vector<System::Clock::Microseconds64> latencies;
+    latencies.reserve(initiatorCount * kConcurrentRounds);
+
+    // Start every initiator, and keep restarting the ones turned away by the responder until all of them have
+    // established a session. CASEServer handles a single handshake at a time and answers any other Sigma1 with a
+    // busy status report, so the initiators turned away are only restarted once no handshake is in progress,
+    // as they would after waiting out the busy delay.
+    auto allSettled = [&]() {
+        return std::all_of(initiators.begin(), initiators.end(), [](const Initiator & initiator) { return initiator.IsSettled(); });
+    };
+    auto runRound = [&]() -> bool {
+        for (auto & initiator : initiators)
+        {
+            initiator.Reset();
+        }
+
+        while (true)
+        {
+            size_t startedCount = 0;
+            for (auto & initiator : initiators)
+            {
+                VerifyOrReturnValue(initiator.GetState() != Initiator::State::kFailed, false);
+                if (initiator.GetState() == Initiator::State::kIdle || initiator.GetState() == Initiator::State::kBusy)
+                {
+                    VerifyOrReturnValue(initiator.Start(*this, nullptr) == CHIP_NO_ERROR, false);
+                    startedCount++;
+                }
+            }
+            VerifyOrReturnValue(startedCount > 0, true);
+            VerifyOrReturnValue(ServiceUntil(allSettled), false);
+        }
+    };
+
+    ASSERT_TRUE(runRound());
+    ExpireSessions();
+
+    uint32_t busyCount = 0;
+    for (auto & initiator : initiators)
+    {
+        initiator.mBusyCount = 0;
+    }
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t round = 0; round < kConcurrentRounds; round++)
+    {
+        bool succeeded = runRound();
+        EXPECT_TRUE(succeeded);
+        if (!succeeded)
+        {
+            return;
+        }
+        for (auto & initiator : initiators)
+        {
+            latencies.push_back(initiator.mLatency);
+        }
+        ExpireSessions();
+    }
+
+    for (auto & initiator : initiators)
+    {
+        busyCount += initiator.mBusyCount;
+        initiator.Reset();
+    }
+
+    const uint64_t handshakes  = initiatorCount * kConcurrentRounds;
+    std::string name           = "CASE/Concurrent/initiators:" + std::to_string(initiatorCount);
+    Benchmark::Result & result = Benchmark::RecordResult(name.c_str(), kConcurrentRounds, stopwatch, handshakes);
+    result.AddCounter("cpu_us_per_handshake", static_cast<double>(result.cpuTime.count()) / static_cast<double>(handshakes))
+        .AddCounter("p50_us", static_cast<double>(Benchmark::Percentile(latencies, 50).count()))
+        .AddCounter("p90_us", static_cast<double>(Benchmark::Percentile(latencies, 90).count()))
+        .AddCounter("p99_us", static_cast<double>(Benchmark::Percentile(latencies, 99).count()))
+        .AddCounter("busy_per_handshake", static_cast<double>(busyCount) / static_cast<double>(handshakes));
+}
+
+TEST_F(CASEBenchmarks, FullHandshake)
+{
+    RunSequential("CASE/FullHandshake", kFullHandshakeIterations, nullptr);
+}
+
+TEST_F(CASEBenchmarks, ResumedHandshake)
+{
+    RunSequential("CASE/ResumedHandshake", kResumptionHandshakeIterations, &gInitiatorResumptionStorage);
+}
+
+TEST_F(CASEBenchmarks, ConcurrentHandshakes)
+{
+    for (size_t initiatorCount : kConcurrentInitiatorCounts)
+    {
+        if (initiatorCount > kMaxConcurrentInitiators)
+        {
+            printf("Skipping CASE/Concurrent/initiators:%u, which exceeds the session and exchange pools\n",
+                   static_cast<unsigned>(initiatorCount));
+            continue;
+        }
+        RunConcurrent(initiatorCount);
+    }
+}
+
+} // namespace
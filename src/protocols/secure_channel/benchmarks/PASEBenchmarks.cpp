@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for PASE session establishment between two PASESessions over the loopback transport.
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/benchmark/Benchmark.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/secure_channel/PASESession.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+
+// Upper bound on the time a single handshake may take before it is considered stuck.
+constexpr System::Clock::Timeout kIterationTimeout = System::Clock::Seconds16(10);
+
+constexpr uint32_t kHandshakeIterations = 50;
+
+// Same parameters as the PASE unit tests; the iteration count is the minimum allowed by the specification.
+constexpr uint32_t kSetupPinCode         = 20202021;
+constexpr uint32_t kPbkdf2IterationCount = 1000;
+constexpr uint8_t kSalt[]                = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20,
+                                             0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+
+class PairingDelegate : public SessionEstablishmentDelegate
+{
+public:
+    void OnSessionEstablishmentError(CHIP_ERROR error) override { mError = error; }
+    void OnSessionEstablished(const SessionHandle & session) override { mEstablished = true; }
+
+    void Reset()
+    {
+        mEstablished = false;
+        mError       = CHIP_NO_ERROR;
+    }
+    bool IsSettled() const { return mEstablished || mError != CHIP_NO_ERROR; }
+
+    bool mEstablished = false;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+};
+
+class PASEBenchmarks : public chip::Test::LoopbackMessagingContext
+{
+public:
+    void SetUp() override
+    {
+        ConfigInitializeNodes(false);
+        LoopbackMessagingContext::SetUp();
+        ASSERT_EQ(mVerifier.Generate(kPbkdf2IterationCount, ByteSpan(kSalt), kSetupPinCode), CHIP_NO_ERROR);
+    }
+
+protected:
+    template <typename Predicate>
+    bool ServiceUntil(Predicate && done)
+    {
+        GetIOContext().DriveIOUntil(kIterationTimeout, std::forward<Predicate>(done));
+        return done();
+    }
+
+    bool RunHandshake(PairingDelegate & initiatorDelegate, PairingDelegate & responderDelegate);
+
+private:
+    Crypto::Spake2pVerifier mVerifier;
+};
+
+bool PASEBenchmarks::RunHandshake(PairingDelegate & initiatorDelegate, PairingDelegate & responderDelegate)
+{
+    PASESession initiator;
+    PASESession responder;
+    initiatorDelegate.Reset();
+    responderDelegate.Reset();
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::PBKDFParamRequest,
+                                                                            &responder),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(responder.WaitForPairing(GetSecureSessionManager(), mVerifier, kPbkdf2IterationCount, ByteSpan(kSalt),
+                                       Optional<ReliableMessageProtocolConfig>::Missing(), &responderDelegate),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * exchange = NewUnauthenticatedExchangeToBob(&initiator);
+    EXPECT_NE(exchange, nullptr);
+    if (exchange != nullptr)
+    {
+        EXPECT_EQ(initiator.Pair(GetSecureSessionManager(), kSetupPinCode, Optional<ReliableMessageProtocolConfig>::Missing(),
+                                 exchange, &initiatorDelegate),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(ServiceUntil([&]() { return initiatorDelegate.IsSettled() && responderDelegate.IsSettled(); }));
+    }
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::PBKDFParamRequest),
+              CHIP_NO_ERROR);
+
+    // Drop the established sessions so that the session table does not fill up over the iterations.
+    GetSecureSessionManager().ExpireAllPASESessions();
+
+    EXPECT_TRUE(initiatorDelegate.mEstablished);
+    EXPECT_TRUE(responderDelegate.mEstablished);
+    return initiatorDelegate.mEstablished && responderDelegate.mEstablished;
+}
+
+TEST_F(PASEBenchmarks, Handshake)
+{
+    PairingDelegate initiatorDelegate;
+    PairingDelegate responderDelegate;
+    std::vector<System::Clock::Microseconds64> latencies;
+    latencies.reserve(kHandshakeIterations);
+
+    // Warm up pools and caches outside of the measured loop.
+    ASSERT_TRUE(RunHandshake(initiatorDelegate, responderDelegate));
+
+    Benchmark::Stopwatch stopwatch;
+    for (uint32_t i = 0; i < kHandshakeIterations; i++)
+    {
+        Benchmark::Stopwatch handshakeStopwatch;
+        ASSERT_TRUE(RunHandshake(initiatorDelegate, responderDelegate));
+        latencies.push_back(handshakeStopwatch.RealTime());
+    }
+
+    // Both sides of the handshake run in this process, so the CPU time covers the initiator and the responder.
+    Benchmark::Result & result = Benchmark::RecordResult("PASE/Handshake", kHandshakeIterations, stopwatch, kHandshakeIterations);
+    result.AddCounter("cpu_us_per_handshake", static_cast<double>(result.cpuTime.count()) / kHandshakeIterations)
+        .AddCounter("p50_us", static_cast<double>(Benchmark::Percentile(latencies, 50).count()))
+        .AddCounter("p90_us", static_cast<double>(Benchmark::Percentile(latencies, 90).count()))
+        .AddCounter("p99_us", static_cast<double>(Benchmark::Percentile(latencies, 99).count()));
+}
+
+} // namespace
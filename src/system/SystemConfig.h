@@ -273,6 +273,19 @@
 #define CHIP_SYSTEM_CONFIG_POOL_USE_HEAP 0
 #endif /* CHIP_SYSTEM_CONFIG_POOL_USE_HEAP */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      Keep pending System::Layer timers in an indexed min-heap (TimerHeap) instead of a sorted linked list (TimerList).
+ *
+ *      Starting and cancelling a timer then costs O(log n) rather than O(n) in the number of pending timers. The heap
+ *      storage is allocated from the platform heap, so this defaults to enabled only when the pools are heap allocated.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_NO_LOCKING
  *
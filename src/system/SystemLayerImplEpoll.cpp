@@ -0,0 +1,576 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    mEventCount   = 0;
+    mTimerFdArmed = false;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct epoll_event event;
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // The timerfd tracks the earliest entry of mTimerList. It is only re-armed when that entry changes.
+    mTimerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // The eventfd allows an arbitrary thread to wake the thread blocked in epoll_wait().
+    mWakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mWakeFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // Both internal descriptors are fully drained whenever they are reported, so edge-triggered
+    // notification is safe and avoids redundant wakeups.
+    event          = {};
+    event.events   = EPOLLIN | EPOLLET;
+    event.data.ptr = &mTimerFd;
+    VerifyOrExit(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    event.data.ptr = &mWakeFd;
+    VerifyOrExit(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        CloseDescriptors();
+        return err;
+    }
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+    CloseDescriptors();
+
+    mEventCount   = 0;
+    mTimerFdArmed = false;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by incrementing the eventfd counter.
+     *
+     * If this is being called from within an I/O event callback, then the wakeup can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this write fails with EAGAIN as that means the counter is saturated,
+     * in which case the epoll calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    uint64_t value = 1;
+    if (::write(mWakeFd, &value, sizeof(value)) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::AddTimer(TimerList::Node * timer, bool & isEarliest)
+{
+    TimerList::Node * earliest = nullptr;
+    CHIP_ERROR err             = mTimerList.Add(timer, earliest);
+    if (err != CHIP_NO_ERROR)
+    {
+        mTimerPool.Release(timer);
+        return err;
+    }
+    isEarliest = (earliest == timer);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
+    if (isEarliest)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        if (remainingTime == Clock::kZero)
+        {
+            // If remaining time is Clock::kZero, it might possible that our timer is in
+            // the mExpiredTimers list and about to be fired. Remove it from that list, since we are extending it.
+            mExpiredTimers.Remove(onComplete, appState);
+        }
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer was not in our "will fire in the future" list, but it might
+        // be in the "we're about to fire these" chunk we already grabbed from
+        // that list.  Check for it there too, and if found there we still want
+        // to cancel it.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Same as LayerImplSelect: use an expires-ASAP timer as a closure, without cancelling
+    // existing timers with the same callback and appState.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
+    if (isEarliest)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The descriptor is only added to the epoll interest list once a read or write callback is requested,
+    // since epoll always reports EPOLLHUP and EPOLLERR for registered descriptors.
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!watch->mPendingIO.Has(SocketEventFlags::kRead), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!watch->mPendingIO.Has(SocketEventFlags::kWrite), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mPendingIO.Has(SocketEventFlags::kRead), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mPendingIO.Has(SocketEventFlags::kWrite), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateInterest(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mRegistered)
+    {
+        // Failure is not fatal here: if the descriptor was already closed the kernel has dropped it from the interest list.
+        (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // Drop any not yet dispatched events for this watch, so that they are not delivered to a
+    // different socket if the slot is reused from within a callback.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == watch)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    watch->Clear();
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Synchronize the epoll interest list with the read/write callbacks requested for a watched socket.
+ *
+ *  Sockets are registered level-triggered: the inet endpoints consume one datagram or one read()
+ *  worth of data per callback, and rely on being called again while more data is pending.
+ */
+CHIP_ERROR LayerImplEpoll::UpdateInterest(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!watch.mPendingIO.HasAny())
+    {
+        VerifyOrReturnError(watch.mRegistered, CHIP_NO_ERROR);
+        watch.mRegistered = false;
+        VerifyOrReturnError(::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch.mFD, nullptr) == 0, CHIP_ERROR_POSIX(errno));
+        return CHIP_NO_ERROR;
+    }
+
+    struct epoll_event event = {};
+    event.events             = (watch.mPendingIO.Has(SocketEventFlags::kRead) ? EPOLLIN : 0u) |
+        (watch.mPendingIO.Has(SocketEventFlags::kWrite) ? EPOLLOUT : 0u);
+    event.data.ptr = &watch;
+
+    const int op = watch.mRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    watch.mRegistered = true;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Program the timerfd to expire at the awaken time of the earliest timer, if that has changed since
+ *  the timerfd was last armed.
+ */
+void LayerImplEpoll::ArmTimerFd()
+{
+    TimerList::Node * timer = mTimerList.Earliest();
+
+    if (timer == nullptr)
+    {
+        VerifyOrReturn(mTimerFdArmed);
+
+        const struct itimerspec disarm = {};
+        if (::timerfd_settime(mTimerFd, 0, &disarm, nullptr) != 0)
+        {
+            ChipLogError(chipSystemLayer, "timerfd disarm failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        }
+        mTimerFdArmed = false;
+        return;
+    }
+
+    VerifyOrReturn(!mTimerFdArmed || timer->AwakenTime() != mTimerFdAwakenTime);
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    const Clock::Timestamp awakenTime  = timer->AwakenTime();
+    Clock::Microseconds64 sleepTime    = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec   = static_cast<time_t>(sleepTime.count() / kMicrosecondsPerSecond);
+    spec.it_value.tv_nsec  = static_cast<long>((sleepTime.count() % kMicrosecondsPerSecond) * kNanosecondsPerMicrosecond);
+    if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+    {
+        // An all-zero it_value disarms the timer; expire as soon as possible instead.
+        spec.it_value.tv_nsec = 1;
+    }
+
+    if (::timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd arm failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+    mTimerFdArmed      = true;
+    mTimerFdAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::CloseDescriptors()
+{
+    for (int * fd : { &mWakeFd, &mTimerFd, &mEpollFd })
+    {
+        if (*fd >= 0)
+        {
+            VerifyOrDie(::close(*fd) == 0);
+            *fd = kInvalidFd;
+        }
+    }
+}
+
+void LayerImplEpoll::DrainFd(int fd)
+{
+    uint64_t value;
+
+    if (::read(fd, &value, sizeof(value)) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        ChipLogError(chipSystemLayer, "System event drain failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+}
+
+SocketEvents LayerImplEpoll::SocketEventsFromEpoll(uint32_t epollEvents, SocketEvents pendingIO)
+{
+    SocketEvents res;
+
+    // Like select(), report hang-up and error conditions as readiness so that the following
+    // read or write surfaces the actual error to the endpoint.
+    if ((epollEvents & (EPOLLIN | EPOLLHUP | EPOLLERR)) && pendingIO.Has(SocketEventFlags::kRead))
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if ((epollEvents & (EPOLLOUT | EPOLLERR)) && pendingIO.Has(SocketEventFlags::kWrite))
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+    if (epollEvents & EPOLLPRI)
+    {
+        res.Set(SocketEventFlags::kExcept);
+    }
+
+    return res;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    ArmTimerFd();
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    // Timers are delivered through mTimerFd, so there is no need for a timeout here.
+    mEventCount = ::epoll_wait(mEpollFd, mEvents, kMaxEpollEvents, -1);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        }
+        mEventCount = 0;
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Drain the internal descriptors first; they carry no payload besides waking us up.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == &mTimerFd)
+        {
+            DrainFd(mTimerFd);
+            // Force re-arming in the next PrepareEvents(), even if the earliest timer did not expire
+            // because of a coarser System::Clock resolution.
+            mTimerFdArmed       = false;
+            mEvents[i].data.ptr = nullptr;
+        }
+        else if (mEvents[i].data.ptr == &mWakeFd)
+        {
+            DrainFd(mWakeFd);
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch == nullptr || watch->mFD == kInvalidFd || watch->mCallback == nullptr)
+        {
+            continue;
+        }
+
+        SocketEvents events = SocketEventsFromEpoll(mEvents[i].events, watch->mPendingIO);
+        if (events.HasAny())
+        {
+            watch->mCallback(events, watch->mCallbackData);
+        }
+    }
+    mEventCount = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mCallback     = nullptr;
+    mCallbackData = 0;
+    mRegistered   = false;
+}
+
+} // namespace System
+} // namespace chip
@@ -89,6 +89,7 @@ void LayerImplSelect::Shutdown()
             dispatch_release(timer->mTimerSource);
         }
     }
+    mTimerList.Clear();
     mTimerPool.ReleaseAll();
 
     for (auto & w : mSocketWatchPool)
@@ -104,6 +105,7 @@ void LayerImplSelect::Shutdown()
             ev_timer_stop(mLibEvLoopP, &timer->mLibEvTimer);
         }
     }
+    mTimerList.Clear();
     mTimerPool.ReleaseAll();
 
     for (auto & w : mSocketWatchPool)
@@ -153,6 +155,19 @@ void LayerImplSelect::Signal()
 #endif // !CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+CHIP_ERROR LayerImplSelect::AddTimer(TimerList::Node * timer, bool & isEarliest)
+{
+    TimerList::Node * earliest = nullptr;
+    CHIP_ERROR err             = mTimerList.Add(timer, earliest);
+    if (err != CHIP_NO_ERROR)
+    {
+        mTimerPool.Release(timer);
+        return err;
+    }
+    isEarliest = (earliest == timer);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
 {
     assertChipStackLockedByCurrentThread();
@@ -170,7 +185,8 @@ CHIP_ERROR LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteCallba
     dispatch_queue_t dispatchQueue = GetDispatchQueue();
     if (dispatchQueue)
     {
-        (void) mTimerList.Add(timer);
+        bool isEarliest = false;
+        ReturnErrorOnFailure(AddTimer(timer, isEarliest));
         dispatch_source_t timerSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, DISPATCH_TIMER_STRICT, dispatchQueue);
         VerifyOrDie(timerSource != nullptr);
 
@@ -200,13 +216,16 @@ CHIP_ERROR LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteCallba
     // Note: Still, slightly early (and of course, late) firing timers are something the caller MUST be prepared for,
     //   because edge cases like system clock adjustments may cause them even with the correction applied here.
     ev_timer_set(&timer->mLibEvTimer, (static_cast<double>(t) / 1E3) + ev_time() - ev_now(mLibEvLoopP), 0.);
-    (void) mTimerList.Add(timer);
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
     ev_timer_start(mLibEvLoopP, &timer->mLibEvTimer);
     return CHIP_NO_ERROR;
 #endif
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     // Note: dispatch based implementation needs this as fallback, but not LIBEV (and dead code is not allowed with -Werror)
-    if (mTimerList.Add(timer) == timer)
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
+    if (isEarliest)
     {
         // The new timer is the earliest, so the time until the next event has probably changed.
         Signal();
@@ -319,7 +338,8 @@ CHIP_ERROR LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete, void
     timer->mLibEvTimer.data = timer;
     auto t                  = Clock::Milliseconds64(0).count();
     ev_timer_set(&timer->mLibEvTimer, static_cast<double>(t) / 1E3, 0.);
-    (void) mTimerList.Add(timer);
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
     ev_timer_start(mLibEvLoopP, &timer->mLibEvTimer);
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH/LIBEV
@@ -353,7 +373,9 @@ CHIP_ERROR LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete, void
     TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    if (mTimerList.Add(timer) == timer)
+    bool isEarliest = false;
+    ReturnErrorOnFailure(AddTimer(timer, isEarliest));
+    if (isEarliest)
     {
         // The new timer is the earliest, so the time until the next event has probably changed.
         Signal();
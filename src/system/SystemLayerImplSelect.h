@@ -128,8 +128,11 @@ protected:
     };
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 
+    // Adds a timer created from mTimerPool to mTimerList, releasing it if mTimerList cannot hold it.
+    CHIP_ERROR AddTimer(TimerList::Node * timer, bool & isEarliest);
+
     TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
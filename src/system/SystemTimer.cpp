@@ -33,6 +33,7 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
 namespace chip {
@@ -178,5 +179,269 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+namespace {
+constexpr size_t kTimerHeapMinCapacity = 16;
+} // namespace
+
+bool TimerHeap::IsEarlier(const Node * a, const Node * b)
+{
+    // Ties are broken by insertion order, so that timers with equal expiration times fire in the order
+    // they were added, as with TimerList.
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    return a->mSequence < b->mSequence;
+}
+
+bool TimerHeap::Reserve(size_t size)
+{
+    VerifyOrReturnValue(size > mCapacity, true);
+
+    size_t capacity = (mCapacity == 0) ? kTimerHeapMinCapacity : mCapacity;
+    while (capacity < size)
+    {
+        capacity *= 2;
+    }
+
+    // Keep one bucket per heap slot, so that the expected chain length stays below one.
+    Node ** buckets = static_cast<Node **>(Platform::MemoryCalloc(capacity, sizeof(Node *)));
+    VerifyOrReturnValue(buckets != nullptr, false);
+
+    // A failed realloc leaves the current heap untouched, so nothing changes unless both allocations succeed.
+    Node ** heap = static_cast<Node **>(Platform::MemoryRealloc(mHeap, capacity * sizeof(Node *)));
+    if (heap == nullptr)
+    {
+        Platform::MemoryFree(buckets);
+        return false;
+    }
+
+    mHeap = heap;
+    Platform::MemoryFree(mBuckets);
+    mBuckets     = buckets;
+    mBucketCount = capacity;
+    mCapacity    = capacity;
+
+    for (size_t i = 0; i < mSize; ++i)
+    {
+        LinkBucket(mHeap[i]);
+    }
+    return true;
+}
+
+size_t TimerHeap::BucketIndex(TimerCompleteCallback onComplete, void * appState) const
+{
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) ^
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) * UINT64_C(31));
+    // Fibonacci hashing; mBucketCount is always a power of two.
+    hash *= UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<size_t>(hash >> 32) & (mBucketCount - 1);
+}
+
+TimerHeap::Node * TimerHeap::Find(TimerCompleteCallback onComplete, void * appState) const
+{
+    VerifyOrReturnValue(mBucketCount > 0, nullptr);
+
+    Node * found = nullptr;
+    for (Node * timer = mBuckets[BucketIndex(onComplete, appState)]; timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+void TimerHeap::LinkBucket(Node * timer)
+{
+    Node *& head         = mBuckets[BucketIndex(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    timer->mNextInBucket = head;
+    head                 = timer;
+}
+
+void TimerHeap::UnlinkBucket(Node * timer)
+{
+    Node ** link = &mBuckets[BucketIndex(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())];
+    while (*link != nullptr)
+    {
+        if (*link == timer)
+        {
+            *link = timer->mNextInBucket;
+            break;
+        }
+        link = &(*link)->mNextInBucket;
+    }
+    timer->mNextInBucket = nullptr;
+}
+
+void TimerHeap::Place(Node * timer, size_t index)
+{
+    mHeap[index]      = timer;
+    timer->mHeapIndex = index;
+}
+
+void TimerHeap::SiftUp(size_t index)
+{
+    Node * timer = mHeap[index];
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!IsEarlier(timer, mHeap[parent]))
+        {
+            break;
+        }
+        Place(mHeap[parent], index);
+        index = parent;
+    }
+    Place(timer, index);
+}
+
+void TimerHeap::SiftDown(size_t index)
+{
+    Node * timer = mHeap[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mSize)
+        {
+            break;
+        }
+        if (child + 1 < mSize && IsEarlier(mHeap[child + 1], mHeap[child]))
+        {
+            ++child;
+        }
+        if (!IsEarlier(mHeap[child], timer))
+        {
+            break;
+        }
+        Place(mHeap[child], index);
+        index = child;
+    }
+    Place(timer, index);
+}
+
+TimerHeap::Node * TimerHeap::RemoveAt(size_t index)
+{
+    Node * removed = mHeap[index];
+    UnlinkBucket(removed);
+
+    --mSize;
+    if (index < mSize)
+    {
+        Place(mHeap[mSize], index);
+        if (index > 0 && IsEarlier(mHeap[index], mHeap[(index - 1) / 2]))
+        {
+            SiftUp(index);
+        }
+        else
+        {
+            SiftDown(index);
+        }
+    }
+
+    removed->mHeapIndex = 0;
+    removed->mNextTimer = nullptr;
+    return removed;
+}
+
+CHIP_ERROR TimerHeap::Add(Node * add, Node *& earliest)
+{
+    VerifyOrDie(!Contains(add));
+    VerifyOrReturnError(Reserve(mSize + 1), CHIP_ERROR_NO_MEMORY);
+
+    add->mSequence     = mNextSequence++;
+    add->mNextTimer    = nullptr;
+    add->mNextInBucket = nullptr;
+    LinkBucket(add);
+    Place(add, mSize++);
+    SiftUp(add->mHeapIndex);
+
+    earliest = Earliest();
+    return CHIP_NO_ERROR;
+}
+
+TimerHeap::Node * TimerHeap::Remove(Node * remove)
+{
+    if (remove != nullptr && Contains(remove))
+    {
+        RemoveAt(remove->mHeapIndex);
+    }
+    return Earliest();
+}
+
+TimerHeap::Node * TimerHeap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, nullptr);
+    return RemoveAt(timer->mHeapIndex);
+}
+
+TimerHeap::Node * TimerHeap::PopEarliest()
+{
+    VerifyOrReturnValue(mSize > 0, nullptr);
+    return RemoveAt(0);
+}
+
+TimerHeap::Node * TimerHeap::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mSize == 0) || !(mHeap[0]->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return RemoveAt(0);
+}
+
+TimerList TimerHeap::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    Node * last = nullptr;
+
+    // Timers come out of the heap in order, so they are appended to the list without searching it.
+    for (Node * timer = PopIfEarlier(t); timer != nullptr; timer = PopIfEarlier(t))
+    {
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+
+    return out;
+}
+
+void TimerHeap::Clear()
+{
+    Platform::MemoryFree(mHeap);
+    Platform::MemoryFree(mBuckets);
+    mHeap        = nullptr;
+    mBuckets     = nullptr;
+    mSize        = 0;
+    mCapacity    = 0;
+    mBucketCount = 0;
+}
+
+Clock::Timeout TimerHeap::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 } // namespace System
 } // namespace chip
@@ -116,6 +116,14 @@ public:
             TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
         {}
         Node * mNextTimer;
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    private:
+        friend class TimerHeap;
+        size_t mHeapIndex    = 0;
+        uint64_t mSequence   = 0;
+        Node * mNextInBucket = nullptr;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
     };
 
     TimerList() : mEarliestTimer(nullptr) {}
@@ -128,6 +136,17 @@ public:
      */
     Node * Add(Node * timer);
 
+    /**
+     * Add a timer to the list, with the same interface as TimerHeap::Add. Adding to a list cannot fail.
+     *
+     * @param[out] earliest  The new earliest timer in the list.
+     */
+    CHIP_ERROR Add(Node * timer, Node *& earliest)
+    {
+        earliest = Add(timer);
+        return CHIP_NO_ERROR;
+    }
+
     /**
      * Remove the given timer from the list, if present. It is not an error for the timer not to be present.
      *
@@ -186,9 +205,144 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    friend class TimerHeap;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
     Node * mEarliestTimer;
 };
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+/**
+ * Collection of `Timer`s ordered by expiration time, with the same interface as TimerList.
+ *
+ * Timers are kept in a binary min-heap indexed from the nodes themselves, so that adding or removing
+ * a timer costs O(log n) instead of a walk over the whole list. A hash index keyed by (onComplete, appState)
+ * makes Remove(onComplete, appState) and GetRemainingTime() O(1) on average, which matters because every
+ * StartTimer() begins with such a cancellation.
+ *
+ * Timers with equal expiration times are returned in the order they were added, as with TimerList.
+ *
+ * Storage grows on demand from the platform heap, so this is intended for configurations that use
+ * CHIP_SYSTEM_CONFIG_POOL_USE_HEAP. Clear() releases it.
+ */
+class TimerHeap
+{
+public:
+    using Node = TimerList::Node;
+
+    TimerHeap() = default;
+    ~TimerHeap() { Clear(); }
+
+    /**
+     * Add a timer to the heap
+     *
+     * @param[out] earliest  The new earliest timer. If this is the newly added timer, that implies it is earlier
+     *                       than any existing timer.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY  The heap could not grow to hold the timer, which was not added.
+     */
+    CHIP_ERROR Add(Node * timer, Node *& earliest);
+
+    /**
+     * Remove the given timer, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer, or nullptr if the heap is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the heap contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer.
+     *
+     * @return  The earliest timer, or nullptr if the heap is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return (mSize > 0) ? mHeap[0] : nullptr; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mSize == 0; }
+
+    /**
+     * Return the number of timers.
+     */
+    size_t Size() const { return mSize; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, as a TimerList.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers, and release the storage used for indexing them.
+     */
+    void Clear();
+
+    /**
+     * Find the timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static bool IsEarlier(const Node * a, const Node * b);
+
+    bool Contains(const Node * timer) const { return timer->mHeapIndex < mSize && mHeap[timer->mHeapIndex] == timer; }
+    bool Reserve(size_t size);
+    size_t BucketIndex(TimerCompleteCallback onComplete, void * appState) const;
+    Node * Find(TimerCompleteCallback onComplete, void * appState) const;
+    void LinkBucket(Node * timer);
+    void UnlinkBucket(Node * timer);
+    void Place(Node * timer, size_t index);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    Node * RemoveAt(size_t index);
+
+    Node ** mHeap          = nullptr;
+    size_t mSize           = 0;
+    size_t mCapacity       = 0;
+    Node ** mBuckets       = nullptr;
+    size_t mBucketCount    = 0;
+    uint64_t mNextSequence = 0;
+
+    TimerHeap(const TimerHeap &)             = delete;
+    TimerHeap & operator=(const TimerHeap &) = delete;
+};
+
+/**
+ * Container used by the System::Layer implementations for timers waiting to expire.
+ */
+using TimerQueue = TimerHeap;
+
+#else // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+using TimerQueue = TimerList;
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
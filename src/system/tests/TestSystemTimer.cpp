@@ -564,6 +564,251 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+// Test TimerHeap against the same sequence of operations as TimerList above.
+TEST_F(TestSystemTimer, CheckTimerHeap)
+{
+    using Timer = TimerList::Node;
+    struct TestState
+    {
+        static void First(Layer * layer, void * state) {}
+        static void Second(Layer * layer, void * state) {}
+    };
+    TestState testState;
+
+    using namespace Clock::Literals;
+    struct
+    {
+        Clock::Timestamp awakenTime;
+        TimerCompleteCallback onComplete;
+        Timer * timer;
+    } testTimer[] = {
+        { 111_ms, TestState::First },  // 0
+        { 100_ms, TestState::First },  // 1
+        { 202_ms, TestState::Second }, // 2
+        { 303_ms, TestState::First },  // 3
+        { 100_ms, TestState::First },  // 4: same expiration time as 1
+    };
+
+    TimerPool<Timer> pool;
+    for (auto & timer : testTimer)
+    {
+        timer.timer = pool.Create(mLayer, timer.awakenTime, timer.onComplete, &testState);
+        ASSERT_NE(timer.timer, nullptr);
+    }
+
+    TimerHeap heap;
+    EXPECT_EQ(heap.Remove(nullptr), nullptr);
+    EXPECT_EQ(heap.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(heap.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(heap.Earliest(), nullptr);
+    EXPECT_TRUE(heap.Empty());
+
+    auto add = [&heap](Timer * timer) {
+        Timer * earliest = nullptr;
+        EXPECT_EQ(heap.Add(timer, earliest), CHIP_NO_ERROR);
+        return earliest;
+    };
+
+    EXPECT_EQ(add(testTimer[0].timer), testTimer[0].timer); // heap: () → (0) returns: 0
+    EXPECT_EQ(heap.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(add(testTimer[1].timer), testTimer[1].timer); // heap: (0) → (1 0) returns: 1
+    EXPECT_EQ(add(testTimer[2].timer), testTimer[1].timer); // heap: (1 0) → (1 0 2) returns: 1
+    EXPECT_EQ(add(testTimer[3].timer), testTimer[1].timer); // heap: (1 0 2) → (1 0 2 3) returns: 1
+    EXPECT_EQ(add(testTimer[4].timer), testTimer[1].timer); // heap: (1 0 2 3) → (1 4 0 2 3) returns: 1
+    EXPECT_EQ(heap.Size(), 5u);
+
+    // Removing a timer that is not the earliest one keeps the earliest.
+    EXPECT_EQ(heap.Remove(testTimer[0].timer), testTimer[1].timer); // heap: (1 4 0 2 3) → (1 4 2 3) returns: 1
+    EXPECT_EQ(heap.Remove(testTimer[0].timer), testTimer[1].timer); // not present
+    EXPECT_EQ(heap.Remove(TestState::Second, &testState), testTimer[2].timer); // heap: (1 4 2 3) → (1 4 3) returns: 2
+    EXPECT_EQ(heap.Remove(TestState::Second, &testState), nullptr);
+
+    // Remove(onComplete, appState) removes the earliest match, and equal expiration times keep insertion order.
+    EXPECT_EQ(heap.Remove(TestState::First, &testState), testTimer[1].timer); // heap: (1 4 3) → (4 3) returns: 1
+    EXPECT_EQ(heap.Earliest(), testTimer[4].timer);
+    EXPECT_EQ(heap.PopEarliest(), testTimer[4].timer); // heap: (4 3) → (3) returns: 4
+    EXPECT_EQ(heap.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(heap.PopIfEarlier(500_ms), testTimer[3].timer); // heap: (3) → () returns: 3
+    EXPECT_TRUE(heap.Empty());
+
+    for (auto & timer : testTimer)
+    {
+        add(timer.timer);
+    }
+    TimerList early = heap.ExtractEarlier(200_ms); // heap: (1 4 0 2 3) → (2 3) returns: (1 4 0)
+    EXPECT_EQ(heap.PopEarliest(), testTimer[2].timer);
+    EXPECT_EQ(heap.PopEarliest(), testTimer[3].timer);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(early.PopEarliest(), testTimer[1].timer);
+    EXPECT_EQ(early.PopEarliest(), testTimer[4].timer);
+    EXPECT_EQ(early.PopEarliest(), testTimer[0].timer);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+
+    add(testTimer[3].timer);
+    heap.Clear();
+    EXPECT_TRUE(heap.Empty());
+
+    pool.ReleaseAll();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+TEST_F(TestSystemTimer, TimerHeapMatchesTimerList)
+{
+    // Start, restart and cancel timers the way System::Layer::StartTimer() (which cancels a matching
+    // timer first) and CancelTimer() do, on both queues, and check that they fire in the same order.
+    using Timer                        = TimerList::Node;
+    static constexpr size_t kNumTimers = 64;
+    static uint8_t sAppStates[kNumTimers];
+
+    TimerPool<Timer> pool;
+    TimerList list;
+    TimerHeap heap;
+    TimerCompleteCallback onComplete = [](Layer *, void *) {};
+
+    // Deterministic pseudo-random expiration times, with duplicates to exercise the insertion order tie break.
+    uint32_t seed = 1;
+    auto next     = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return Clock::Timestamp((seed >> 8) % 32);
+    };
+
+    auto start = [&](void * appState) {
+        const Clock::Timestamp awakenTime = next();
+        Timer * earliest                  = nullptr;
+
+        Timer * listTimer = pool.Create(mLayer, awakenTime, onComplete, appState);
+        ASSERT_NE(listTimer, nullptr);
+        EXPECT_EQ(list.Add(listTimer, earliest), CHIP_NO_ERROR);
+
+        Timer * heapTimer = pool.Create(mLayer, awakenTime, onComplete, appState);
+        ASSERT_NE(heapTimer, nullptr);
+        EXPECT_EQ(heap.Add(heapTimer, earliest), CHIP_NO_ERROR);
+    };
+
+    auto cancel = [&](void * appState) {
+        Timer * listTimer = list.Remove(onComplete, appState);
+        Timer * heapTimer = heap.Remove(onComplete, appState);
+        ASSERT_NE(listTimer, nullptr);
+        ASSERT_NE(heapTimer, nullptr);
+        EXPECT_EQ(listTimer->AwakenTime(), heapTimer->AwakenTime());
+        pool.Release(listTimer);
+        pool.Release(heapTimer);
+    };
+
+    for (auto & appState : sAppStates)
+    {
+        start(&appState);
+    }
+    for (size_t i = 0; i < kNumTimers; i += 3)
+    {
+        cancel(&sAppStates[(i * 7) % kNumTimers]);
+        start(&sAppStates[(i * 7) % kNumTimers]);
+    }
+    for (size_t i = 0; i < kNumTimers; i += 4)
+    {
+        cancel(&sAppStates[i]);
+    }
+    EXPECT_EQ(heap.Size(), kNumTimers - kNumTimers / 4);
+
+    Timer * listTimer;
+    while ((listTimer = list.PopEarliest()) != nullptr)
+    {
+        Timer * heapTimer = heap.PopEarliest();
+        ASSERT_NE(heapTimer, nullptr);
+        EXPECT_EQ(listTimer->GetCallback().GetAppState(), heapTimer->GetCallback().GetAppState());
+        EXPECT_EQ(listTimer->AwakenTime(), heapTimer->AwakenTime());
+    }
+    EXPECT_TRUE(heap.Empty());
+
+    pool.ReleaseAll();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+namespace {
+
+// Measure the cost of starting and cancelling timers with many outstanding timers, as done
+// by System::Layer::StartTimer() (which cancels a matching timer first) and CancelTimer().
+template <typename Queue>
+void BenchmarkTimerQueue(const char * name, Layer & layer)
+{
+    using Timer                         = TimerList::Node;
+    static constexpr size_t kNumTimers  = 10000;
+    static constexpr size_t kNumRestart = 10000;
+    static uint8_t sAppStates[kNumTimers];
+
+    TimerPool<Timer> pool;
+    Queue queue;
+    TimerCompleteCallback onComplete = [](Layer *, void *) {};
+    Timer * earliest                 = nullptr;
+
+    // Deterministic pseudo-random expiration times, so that insertion does not always hit the same end of the queue.
+    uint32_t seed = 1;
+    auto next     = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return Clock::Timestamp((seed >> 8) % 3600000u);
+    };
+
+    Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (auto & appState : sAppStates)
+    {
+        Timer * timer = pool.Create(layer, next(), onComplete, &appState);
+        ASSERT_NE(timer, nullptr);
+        ASSERT_EQ(queue.Add(timer, earliest), CHIP_NO_ERROR);
+    }
+    Clock::Microseconds64 started = SystemClock().GetMonotonicMicroseconds64();
+
+    // Restart existing timers: cancel by (onComplete, appState), then start again.
+    for (size_t i = 0; i < kNumRestart; ++i)
+    {
+        void * appState = &sAppStates[(i * 7919) % kNumTimers];
+        Timer * timer   = queue.Remove(onComplete, appState);
+        ASSERT_NE(timer, nullptr);
+        pool.Release(timer);
+        timer = pool.Create(layer, next(), onComplete, appState);
+        ASSERT_NE(timer, nullptr);
+        ASSERT_EQ(queue.Add(timer, earliest), CHIP_NO_ERROR);
+    }
+    Clock::Microseconds64 restarted = SystemClock().GetMonotonicMicroseconds64();
+
+    for (auto & appState : sAppStates)
+    {
+        Timer * timer = queue.Remove(onComplete, &appState);
+        ASSERT_NE(timer, nullptr);
+        pool.Release(timer);
+    }
+    Clock::Microseconds64 cancelled = SystemClock().GetMonotonicMicroseconds64();
+
+    EXPECT_TRUE(queue.Empty());
+    queue.Clear();
+    pool.ReleaseAll();
+
+    ChipLogProgress(Test, "%s with %u timers: start %u ns/op, restart %u ns/op, cancel %u ns/op", name,
+                    static_cast<unsigned>(kNumTimers), static_cast<unsigned>((started - start).count() * 1000 / kNumTimers),
+                    static_cast<unsigned>((restarted - started).count() * 1000 / kNumRestart),
+                    static_cast<unsigned>((cancelled - restarted).count() * 1000 / kNumTimers));
+}
+
+} // namespace
+
+TEST_F(TestSystemTimer, StartCancelBenchmark)
+{
+    BenchmarkTimerQueue<TimerList>("TimerList", mLayer);
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    BenchmarkTimerQueue<TimerHeap>("TimerHeap", mLayer);
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+}
+
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
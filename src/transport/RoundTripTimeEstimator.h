@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines an estimator of the round trip time to a peer, as
+ *      measured from the time taken for messages to be acknowledged.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ *  Keeps a smoothed round trip time (SRTT) and round trip time variation (RTTVAR)
+ *  following the algorithm of RFC 6298, section 2.
+ *
+ *  Samples MUST only be taken from messages that were not retransmitted, since an
+ *  acknowledgement of a retransmitted message cannot be matched to a transmission
+ *  (Karn's algorithm).
+ */
+class RoundTripTimeEstimator
+{
+public:
+    /// Samples above this are clamped, so that a single stalled acknowledgement cannot overflow the estimates.
+    static constexpr System::Clock::Milliseconds32 kMaxSample = System::Clock::Milliseconds32(60000);
+
+    /**
+     *  Adds a measured round trip time to the estimates.
+     */
+    void AddSample(System::Clock::Milliseconds32 sample)
+    {
+        const uint32_t rttUs = std::min(sample, kMaxSample).count() * kMicrosecondsPerMillisecond;
+
+        if (mSampleCount == 0)
+        {
+            mSmoothedRttUs  = rttUs;
+            mRttVariationUs = rttUs / 2;
+        }
+        else
+        {
+            // RTTVAR <- (1 - beta) * RTTVAR + beta * |SRTT - R'| with beta = 1/4, then
+            // SRTT <- (1 - alpha) * SRTT + alpha * R' with alpha = 1/8
+            const uint32_t deviationUs = (mSmoothedRttUs > rttUs) ? (mSmoothedRttUs - rttUs) : (rttUs - mSmoothedRttUs);
+            mRttVariationUs            = (3 * mRttVariationUs + deviationUs) / 4;
+            mSmoothedRttUs             = (7 * mSmoothedRttUs + rttUs) / 8;
+        }
+
+        if (mSampleCount < UINT16_MAX)
+        {
+            mSampleCount++;
+        }
+    }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+
+    /// Number of samples taken since the last reset, saturating at UINT16_MAX.
+    uint16_t GetSampleCount() const { return mSampleCount; }
+
+    System::Clock::Milliseconds32 GetSmoothedRtt() const { return ToMilliseconds(mSmoothedRttUs); }
+
+    System::Clock::Milliseconds32 GetRttVariation() const { return ToMilliseconds(mRttVariationUs); }
+
+    /**
+     *  Returns the retransmission timeout derived from the estimates, SRTT + max(G, 4 * RTTVAR),
+     *  using a clock granularity G of 1 ms. Only meaningful if HasEstimate() is true.
+     */
+    System::Clock::Milliseconds32 GetRetransmissionTimeout() const
+    {
+        constexpr uint32_t kClockGranularityUs = kMicrosecondsPerMillisecond;
+        return ToMilliseconds(mSmoothedRttUs + std::max(kClockGranularityUs, 4 * mRttVariationUs));
+    }
+
+    void Reset()
+    {
+        mSmoothedRttUs  = 0;
+        mRttVariationUs = 0;
+        mSampleCount    = 0;
+    }
+
+private:
+    static constexpr uint32_t kMicrosecondsPerMillisecond = 1000;
+
+    // Rounds up, so that sub-millisecond estimates never yield a zero timeout.
+    static System::Clock::Milliseconds32 ToMilliseconds(uint32_t us)
+    {
+        return System::Clock::Milliseconds32((us + kMicrosecondsPerMillisecond - 1) / kMicrosecondsPerMillisecond);
+    }
+
+    // Estimates are kept in microseconds so that the fractional gains do not truncate
+    // millisecond samples; with samples clamped to kMaxSample none of the arithmetic overflows.
+    uint32_t mSmoothedRttUs  = 0;
+    uint32_t mRttVariationUs = 0;
+    uint16_t mSampleCount    = 0;
+};
+
+} // namespace Transport
+} // namespace chip
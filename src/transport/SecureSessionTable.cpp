@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = CreateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                           fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -337,9 +337,43 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+CHIP_ERROR SecureSessionTable::AddToIndex(SecureSession & session)
+{
+    // Grow both indexes first, so that a failure cannot leave the session in only one of them.
+    ReturnErrorOnFailure(mLocalSessionIdIndex.Reserve(mLocalSessionIdIndex.Size() + 1));
+    ReturnErrorOnFailure(mPeerIndex.Reserve(mPeerIndex.Size() + 1));
+
+    ReturnErrorOnFailure(mLocalSessionIdIndex.Insert(session.GetLocalSessionId(), &session));
+    return mPeerIndex.Insert(PeerHash(session.GetPeer()), &session);
+}
+
+void SecureSessionTable::RemoveFromIndex(SecureSession & session)
+{
+    mLocalSessionIdIndex.Remove(session.GetLocalSessionId(), &session);
+    mPeerIndex.Remove(PeerHash(session.GetPeer()), &session);
+}
+
+SecureSession * SecureSessionTable::FindIndexedSession(uint16_t localSessionId) const
+{
+    return mLocalSessionIdIndex.Find(localSessionId,
+                                     [localSessionId](SecureSession * session) { return session->GetLocalSessionId() == localSessionId; });
+}
+
+void SecureSessionTable::SessionPeerChanged(SecureSession & session, const ScopedNodeId & previousPeer)
+{
+    VerifyOrReturn(mPeerIndex.Remove(PeerHash(previousPeer), &session));
+    // Cannot fail: the index already held this entry, so no allocation is needed.
+    VerifyOrDie(mPeerIndex.Insert(PeerHash(session.GetPeer()), &session) == CHIP_NO_ERROR);
+}
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
     SecureSession * result = nullptr;
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    result = FindIndexedSession(localSessionId);
+#else
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
         {
@@ -348,11 +382,27 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
+    {
+        if (candidate == kUnsecuredSessionId)
+        {
+            continue; // kUnsecuredSessionId is never available
+        }
+        if (FindIndexedSession(candidate) == nullptr)
+        {
+            return MakeOptional<uint16_t>(candidate);
+        }
+    }
+    return NullOptional;
+#else
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -401,6 +451,7 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     }
 
     return NullOptional;
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
 }
 
 } // namespace Transport
@@ -18,6 +18,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
@@ -76,7 +77,13 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        RemoveFromIndex(*session);
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +91,25 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Iterate over the sessions whose GetPeer() is the given peer, in no particular order.
+     *
+     * The function must not allocate or release sessions.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        return mPeerIndex.ForEachMatch(PeerHash(peer), [&](SecureSession * session) {
+            return (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+        });
+#else
+        return mEntries.ForEachActiveObject([&](SecureSession * session) {
+            return (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+        });
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -122,6 +148,35 @@ public:
 
 private:
     friend class TestSecureSessionTable;
+    friend class SecureSession;
+
+    /**
+     * Allocate a session object out of the pool and add it to the lookup indexes, if enabled.
+     *
+     * @return the session, or nullptr if the pool or the indexes are out of memory.
+     */
+    template <typename... Args>
+    SecureSession * CreateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        if (session != nullptr && AddToIndex(*session) != CHIP_NO_ERROR)
+        {
+            mEntries.ReleaseObject(session);
+            session = nullptr;
+        }
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        return session;
+    }
+
+    /**
+     * Called by a session after its peer (node ID and/or fabric index) changed from previousPeer.
+     */
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    void SessionPeerChanged(SecureSession & session, const ScopedNodeId & previousPeer);
+#else
+    void SessionPeerChanged(SecureSession &, const ScopedNodeId &) {}
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
 
     /**
      * This provides a sortable wrapper for a SecureSession object. A SecureSession
@@ -248,8 +303,10 @@ private:
      * from the starting mNextSessionId clue.
      *
      * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  When
+     * CHIP_CONFIG_SESSION_TABLE_HASH_INDEX is enabled, candidate IDs are instead
+     * probed one by one in the local session ID index, which selects the same ID
+     * with at most CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE + 1 expected constant time lookups.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
@@ -259,6 +316,21 @@ private:
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    static uint32_t PeerHash(const ScopedNodeId & peer)
+    {
+        return HashIndexFold(peer.GetNodeId()) ^ (static_cast<uint32_t>(peer.GetFabricIndex()) << 24);
+    }
+
+    CHIP_ERROR AddToIndex(SecureSession & session);
+    void RemoveFromIndex(SecureSession & session);
+    SecureSession * FindIndexedSession(uint16_t localSessionId) const;
+
+    // Every allocated session is present in both indexes, keyed by local session ID and by GetPeer() respectively.
+    HashIndex<SecureSession> mLocalSessionIdIndex;
+    HashIndex<SecureSession> mPeerIndex;
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
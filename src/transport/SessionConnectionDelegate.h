@@ -41,6 +41,21 @@ public:
      * @param conErr        The connection error code
      */
     virtual void OnTCPConnectionClosed(const SessionHandle & session, CHIP_ERROR conErr) = 0;
+
+    /**
+     * @brief
+     *   Called when the amount of data queued for sending on the underlying
+     *   connection for the session crosses CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+     *   (isBackpressured is true), and again once it drains to
+     *   CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK (isBackpressured is false).
+     *
+     *   Messages sent while the connection is backpressured are still queued;
+     *   bulk senders should pause until the backpressure is relieved.
+     *
+     * @param session           The handle to the secure session
+     * @param isBackpressured   Whether the connection is backpressured
+     */
+    virtual void OnTCPConnectionBackpressure(const SessionHandle & session, bool isBackpressured) {}
 };
 
 } // namespace chip
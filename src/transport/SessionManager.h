@@ -487,6 +487,8 @@ public:
 
     void HandleConnectionClosed(Transport::ActiveTCPConnectionState * conn, CHIP_ERROR conErr) override;
 
+    void HandleConnectionBackpressure(Transport::ActiveTCPConnectionState * conn, bool isBackpressured) override;
+
     // Functors for callbacks into higher layers
     using OnTCPConnectionReceivedCallback = void (*)(Transport::ActiveTCPConnectionState * conn);
 
@@ -71,6 +71,15 @@ public:
     virtual void HandleConnectionClosed(Transport::ActiveTCPConnectionState * conn, CHIP_ERROR conErr){};
 
     virtual void HandleConnectionReceived(Transport::ActiveTCPConnectionState * conn){};
+
+    /**
+     * @brief
+     *   Handle a change of the send queue backpressure state of a connection.
+     *
+     * @param conn              the connection object
+     * @param isBackpressured   whether the send queue of the connection is above its high watermark
+     */
+    virtual void HandleConnectionBackpressure(Transport::ActiveTCPConnectionState * conn, bool isBackpressured){};
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 };
 
@@ -152,6 +152,14 @@ void TransportMgrBase::HandleConnectionClosed(Transport::ActiveTCPConnectionStat
         }
     }
 }
+
+void TransportMgrBase::HandleConnectionBackpressure(Transport::ActiveTCPConnectionState * conn, bool isBackpressured)
+{
+    if (mSessionManager != nullptr)
+    {
+        mSessionManager->HandleConnectionBackpressure(conn, isBackpressured);
+    }
+}
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
 } // namespace chip
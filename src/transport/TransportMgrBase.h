@@ -55,6 +55,8 @@ public:
     void HandleConnectionAttemptComplete(Transport::ActiveTCPConnectionState * conn, CHIP_ERROR conErr) override;
 
     void HandleConnectionClosed(Transport::ActiveTCPConnectionState * conn, CHIP_ERROR conErr) override;
+
+    void HandleConnectionBackpressure(Transport::ActiveTCPConnectionState * conn, bool isBackpressured) override;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
     void SetSessionManager(TransportMgrDelegate * sessionManager) { mSessionManager = sessionManager; }
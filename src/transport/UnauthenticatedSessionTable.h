@@ -17,9 +17,11 @@
 #pragma once
 
 #include <ble/Ble.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Pool.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemConfig.h>
@@ -307,7 +309,7 @@ private:
                           const PeerAddress & peerAddress, const ReliableMessageProtocolConfig & config,
                           UnauthenticatedSession *& entry)
     {
-        auto entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, *this);
+        auto entryToUse = CreateEntry(sessionRole, ephemeralInitiatorNodeID, peerAddress, config);
         if (entryToUse != nullptr)
         {
             entry = entryToUse;
@@ -322,8 +324,8 @@ private:
         VerifyOrReturnError(entryToUse != nullptr, CHIP_ERROR_NO_MEMORY);
 
         // Drop the least recent entry to allow for a new alloc.
-        mEntries.ReleaseObject(entryToUse);
-        entryToUse = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, *this);
+        ReleaseEntry(entryToUse);
+        entryToUse = CreateEntry(sessionRole, ephemeralInitiatorNodeID, peerAddress, config);
 
         if (entryToUse == nullptr)
         {
@@ -340,10 +342,17 @@ private:
                                                           NodeId ephemeralInitiatorNodeID,
                                                           const Transport::PeerAddress & peerAddress)
     {
+        auto matches = [&](UnauthenticatedSession * entry) {
+            return entry->GetSessionRole() == sessionRole && entry->GetEphemeralInitiatorNodeID() == ephemeralInitiatorNodeID &&
+                entry->GetPeerAddress().GetTransportType() == peerAddress.GetTransportType();
+        };
+
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        return mIndex.Find(HashIndexFold(ephemeralInitiatorNodeID), matches);
+#else
         UnauthenticatedSession * result = nullptr;
         mEntries.ForEachActiveObject([&](UnauthenticatedSession * entry) {
-            if (entry->GetSessionRole() == sessionRole && entry->GetEphemeralInitiatorNodeID() == ephemeralInitiatorNodeID &&
-                entry->GetPeerAddress().GetTransportType() == peerAddress.GetTransportType())
+            if (matches(entry))
             {
                 result = entry;
                 return Loop::Break;
@@ -351,6 +360,7 @@ private:
             return Loop::Continue;
         });
         return result;
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
     }
 
     EntryType * FindLeastRecentUsedEntry()
@@ -370,9 +380,34 @@ private:
         return result;
     }
 
-    void ReleaseEntry(EntryType * entry) { mEntries.ReleaseObject(entry); }
+    EntryType * CreateEntry(UnauthenticatedSession::SessionRole sessionRole, NodeId ephemeralInitiatorNodeID,
+                            const PeerAddress & peerAddress, const ReliableMessageProtocolConfig & config)
+    {
+        EntryType * entry = mEntries.CreateObject(sessionRole, ephemeralInitiatorNodeID, peerAddress, config, *this);
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        if (entry != nullptr && mIndex.Insert(HashIndexFold(ephemeralInitiatorNodeID), entry) != CHIP_NO_ERROR)
+        {
+            mEntries.ReleaseObject(entry);
+            entry = nullptr;
+        }
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        return entry;
+    }
+
+    void ReleaseEntry(EntryType * entry)
+    {
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        mIndex.Remove(HashIndexFold(entry->GetEphemeralInitiatorNodeID()), entry);
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+        mEntries.ReleaseObject(entry);
+    }
 
     ObjectPool<EntryType, kMaxSessionCount> mEntries;
+
+#if CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
+    // Every allocated entry, keyed by its ephemeral initiator node ID.
+    HashIndex<UnauthenticatedSession> mIndex;
+#endif // CHIP_CONFIG_SESSION_TABLE_HASH_INDEX
 };
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
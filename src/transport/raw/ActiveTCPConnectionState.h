@@ -54,19 +54,21 @@ struct ActiveTCPConnectionState
 
     void Init(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddr)
     {
-        mEndPoint = endPoint;
-        mPeerAddr = peerAddr;
-        mReceived = nullptr;
-        mAppState = nullptr;
+        mEndPoint          = endPoint;
+        mPeerAddr          = peerAddr;
+        mReceived          = nullptr;
+        mAppState          = nullptr;
+        mSendBackpressured = false;
     }
 
     void Free()
     {
         mEndPoint->Free();
-        mPeerAddr = PeerAddress::Uninitialized();
-        mEndPoint = nullptr;
-        mReceived = nullptr;
-        mAppState = nullptr;
+        mPeerAddr          = PeerAddress::Uninitialized();
+        mEndPoint          = nullptr;
+        mReceived          = nullptr;
+        mAppState          = nullptr;
+        mSendBackpressured = false;
     }
 
     bool InUse() const { return mEndPoint != nullptr; }
@@ -75,6 +77,10 @@ struct ActiveTCPConnectionState
 
     bool IsConnecting() const { return (mEndPoint != nullptr && mConnectionState == TCPState::kConnecting); }
 
+    // Whether more than CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK bytes were queued for sending,
+    // and the queue has not yet drained to CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK.
+    bool IsSendBackpressured() const { return mSendBackpressured; }
+
     // Associated endpoint.
     Inet::TCPEndPoint * mEndPoint;
 
@@ -100,6 +106,9 @@ struct ActiveTCPConnectionState
     // KeepAlive interval in seconds
     uint16_t mTCPKeepAliveIntervalSecs = CHIP_CONFIG_TCP_KEEPALIVE_INTERVAL_SECS;
     uint16_t mTCPMaxNumKeepAliveProbes = CHIP_CONFIG_MAX_TCP_KEEPALIVE_PROBES;
+
+    // Send queue backpressure state, see IsSendBackpressured()
+    bool mSendBackpressured = false;
 };
 
 // Functors for callbacks into higher layers
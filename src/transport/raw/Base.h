@@ -55,6 +55,7 @@ public:
     virtual void HandleConnectionReceived(ActiveTCPConnectionState * conn){};
     virtual void HandleConnectionAttemptComplete(ActiveTCPConnectionState * conn, CHIP_ERROR conErr){};
     virtual void HandleConnectionClosed(ActiveTCPConnectionState * conn, CHIP_ERROR conErr){};
+    virtual void HandleConnectionBackpressure(ActiveTCPConnectionState * conn, bool isBackpressured){};
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 };
 
@@ -153,6 +154,13 @@ protected:
     {
         mDelegate->HandleConnectionClosed(conn, conErr);
     }
+
+    // Callback to notify the higher layer that the send queue of a connection crossed
+    // its high (isBackpressured true) or low (isBackpressured false) watermark.
+    void HandleConnectionBackpressure(ActiveTCPConnectionState * conn, bool isBackpressured)
+    {
+        mDelegate->HandleConnectionBackpressure(conn, isBackpressured);
+    }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
     RawTransportDelegate * mDelegate = nullptr;
@@ -63,15 +63,24 @@ TCPBase::~TCPBase()
     }
 
     CloseActiveConnections();
+
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    for (size_t i = 0; i < mConnectionChunkCount; i++)
+    {
+        Platform::Delete(mConnectionChunks[i]);
+        mConnectionChunks[i] = nullptr;
+    }
+    mConnectionChunkCount = 0;
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
 }
 
 void TCPBase::CloseActiveConnections()
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (mActiveConnections[i].InUse())
+        if (ConnectionAt(i).InUse())
         {
-            CloseConnectionInternal(&mActiveConnections[i], CHIP_NO_ERROR, SuppressCallback::Yes);
+            CloseConnectionInternal(&ConnectionAt(i), CHIP_NO_ERROR, SuppressCallback::Yes);
         }
     }
 }
@@ -128,17 +137,53 @@ void TCPBase::Close()
     mState = TCPState::kNotReady;
 }
 
+size_t TCPBase::ConnectionCapacity() const
+{
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    return mActiveConnectionsSize + mConnectionChunkCount * kConnectionChunkSize;
+#else
+    return mActiveConnectionsSize;
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+}
+
+ActiveTCPConnectionState & TCPBase::ConnectionAt(size_t index) const
+{
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    if (index >= mActiveConnectionsSize)
+    {
+        index -= mActiveConnectionsSize;
+        return mConnectionChunks[index / kConnectionChunkSize]->mConnections[index % kConnectionChunkSize];
+    }
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    return mActiveConnections[index];
+}
+
 ActiveTCPConnectionState * TCPBase::AllocateConnection()
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (!mActiveConnections[i].InUse())
+        if (!ConnectionAt(i).InUse())
         {
-            return &mActiveConnections[i];
+            return &ConnectionAt(i);
         }
     }
 
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    // All allocated connections are in use, grow the pool
+    VerifyOrReturnValue(mConnectionChunkCount < kMaxConnectionChunks, nullptr);
+
+    ConnectionChunk * chunk = Platform::New<ConnectionChunk>();
+    VerifyOrReturnValue(chunk != nullptr, nullptr);
+    for (auto & connection : chunk->mConnections)
+    {
+        connection.Init(nullptr, PeerAddress::Uninitialized());
+    }
+    mConnectionChunks[mConnectionChunkCount++] = chunk;
+
+    return &chunk->mConnections[0];
+#else
     return nullptr;
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
 }
 
 // Find an ActiveTCPConnectionState corresponding to a peer address
@@ -149,19 +194,20 @@ ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & add
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (!mActiveConnections[i].IsConnected())
+        ActiveTCPConnectionState & connection = ConnectionAt(i);
+        if (!connection.IsConnected())
         {
             continue;
         }
         Inet::IPAddress addr;
         uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
+        connection.mEndPoint->GetPeerInfo(&addr, &port);
 
         if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
         {
-            return &mActiveConnections[i];
+            return &connection;
         }
     }
 
@@ -171,11 +217,11 @@ ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & add
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
 ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint * endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint && mActiveConnections[i].IsConnected())
+        if (ConnectionAt(i).mEndPoint == endPoint && ConnectionAt(i).IsConnected())
         {
-            return &mActiveConnections[i];
+            return &ConnectionAt(i);
         }
     }
     return nullptr;
@@ -188,11 +234,11 @@ ActiveTCPConnectionState * TCPBase::FindInUseConnection(const Inet::TCPEndPoint
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (mActiveConnections[i].mEndPoint == endPoint)
+        if (ConnectionAt(i).mEndPoint == endPoint)
         {
-            return &mActiveConnections[i];
+            return &ConnectionAt(i);
         }
     }
     return nullptr;
@@ -223,7 +269,9 @@ CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::
 
     if (connection != nullptr)
     {
-        return connection->mEndPoint->Send(std::move(msgBuf));
+        CHIP_ERROR err = connection->mEndPoint->Send(std::move(msgBuf));
+        UpdateSendBackpressure(connection);
+        return err;
     }
 
     return SendAfterConnect(address, std::move(msgBuf));
@@ -293,7 +341,7 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     }
 
     // Ensures sufficient active connections size exist
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mUsedEndPointCount < MaxConnections(), CHIP_ERROR_NO_MEMORY);
 
     Transport::ActiveTCPConnectionState * peerConnState = nullptr;
     ReturnErrorOnFailure(StartConnect(addr, nullptr, &peerConnState));
@@ -433,6 +481,30 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHI
     }
 }
 
+void TCPBase::UpdateSendBackpressure(ActiveTCPConnectionState * connection)
+{
+#if CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK > 0
+    // Sending may have closed the connection
+    VerifyOrReturn(connection->IsConnected());
+
+    const size_t pendingLength = connection->mEndPoint->PendingSendLength();
+    if (!connection->mSendBackpressured && (pendingLength >= CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK))
+    {
+        connection->mSendBackpressured = true;
+    }
+    else if (connection->mSendBackpressured && (pendingLength <= CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK))
+    {
+        connection->mSendBackpressured = false;
+    }
+    else
+    {
+        return;
+    }
+
+    HandleConnectionBackpressure(connection, connection->mSendBackpressured);
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK > 0
+}
+
 CHIP_ERROR TCPBase::HandleTCPEndPointDataReceived(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
 {
     Inet::IPAddress ipAddress;
@@ -475,7 +547,7 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
     {
         // Set the Data received handler when connection completes
         endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
-        endPoint->OnDataSent         = nullptr;
+        endPoint->OnDataSent         = HandleTCPEndPointDataSent;
         endPoint->OnConnectionClosed = HandleTCPEndPointConnectionClosed;
 
         activeConnection = tcp->FindInUseConnection(endPoint);
@@ -510,6 +582,7 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
             }
             return Loop::Continue;
         });
+        tcp->UpdateSendBackpressure(activeConnection);
 
         // Set the TCPKeepalive configurations on the established connection
         endPoint->EnableKeepAlive(activeConnection->mTCPKeepAliveIntervalSecs, activeConnection->mTCPMaxNumKeepAliveProbes);
@@ -528,6 +601,17 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
     }
 }
 
+void TCPBase::HandleTCPEndPointDataSent(Inet::TCPEndPoint * endPoint, size_t len)
+{
+    TCPBase * tcp                               = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    ActiveTCPConnectionState * activeConnection = tcp->FindActiveConnection(endPoint);
+
+    if (activeConnection != nullptr && activeConnection->IsSendBackpressured())
+    {
+        tcp->UpdateSendBackpressure(activeConnection);
+    }
+}
+
 void TCPBase::HandleTCPEndPointConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 {
     TCPBase * tcp                               = reinterpret_cast<TCPBase *>(endPoint->mAppState);
@@ -561,13 +645,16 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
     endPoint->GetInterfaceId(&interfaceId);
     PeerAddress addr = PeerAddress::TCP(ipAddress, port, interfaceId);
 
-    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
+    if (tcp->mUsedEndPointCount < tcp->MaxConnections())
     {
         activeConnection = tcp->AllocateConnection();
+    }
 
+    if (activeConnection != nullptr)
+    {
         endPoint->mAppState          = listenEndPoint->mAppState;
         endPoint->OnDataReceived     = HandleTCPEndPointDataReceived;
-        endPoint->OnDataSent         = nullptr;
+        endPoint->OnDataSent         = HandleTCPEndPointDataSent;
         endPoint->OnConnectionClosed = HandleTCPEndPointConnectionClosed;
 
         // By default, disable TCP Nagle buffering by setting TCP_NODELAY socket option to true
@@ -610,7 +697,7 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
     // Verify that PeerAddress AddressType is TCP
     VerifyOrReturnError(address.GetTransportType() == Transport::Type::kTcp, CHIP_ERROR_INVALID_ARGUMENT);
 
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mUsedEndPointCount < MaxConnections(), CHIP_ERROR_NO_MEMORY);
 
     char addrStr[Transport::PeerAddress::kMaxToStringSize];
     address.ToString(addrStr);
@@ -624,12 +711,12 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
 void TCPBase::TCPDisconnect(const PeerAddress & address)
 {
     // Closes an existing connection
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (mActiveConnections[i].IsConnected())
+        if (ConnectionAt(i).IsConnected())
         {
-            const Inet::IPAddress & ipAddress = mActiveConnections[i].mPeerAddr.GetIPAddress();
-            uint16_t port                     = mActiveConnections[i].mPeerAddr.GetPort();
+            const Inet::IPAddress & ipAddress = ConnectionAt(i).mPeerAddr.GetIPAddress();
+            uint16_t port                     = ConnectionAt(i).mPeerAddr.GetPort();
 
             // Ignoring the InterfaceID in the check as it may not have been provided in
             // the PeerAddress during connection establishment. The IPAddress and Port
@@ -640,7 +727,7 @@ void TCPBase::TCPDisconnect(const PeerAddress & address)
                 // NOTE: this leaves the socket in TIME_WAIT.
                 // Calling Abort() would clean it since SO_LINGER would be set to 0,
                 // however this seems not to be useful.
-                CloseConnectionInternal(&mActiveConnections[i], CHIP_NO_ERROR, SuppressCallback::Yes);
+                CloseConnectionInternal(&ConnectionAt(i), CHIP_NO_ERROR, SuppressCallback::Yes);
             }
         }
     }
@@ -670,9 +757,9 @@ void TCPBase::TCPDisconnect(Transport::ActiveTCPConnectionState * conn, bool sho
 
 bool TCPBase::HasActiveConnections() const
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    for (size_t i = 0; i < ConnectionCapacity(); i++)
     {
-        if (mActiveConnections[i].IsConnected())
+        if (ConnectionAt(i).IsConnected())
         {
             return true;
         }
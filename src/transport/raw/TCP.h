@@ -32,6 +32,7 @@
 #include <inet/InetInterface.h>
 #include <inet/TCPEndPoint.h>
 #include <lib/core/CHIPCore.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/PoolWrapper.h>
 #include <transport/raw/ActiveTCPConnectionState.h>
@@ -122,6 +123,8 @@ public:
         mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
     {
         // activeConnectionsBuffer must be initialized by the caller.
+        // Once all of its connections are in use, up to CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS more are
+        // allocated from the heap.
     }
     ~TCPBase() override;
 
@@ -211,8 +214,25 @@ private:
     /**
      * Allocate an unused connection from the pool
      *
+     * If all preallocated connections are in use, the pool grows by up to
+     * CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS connections allocated from the heap.
      */
     ActiveTCPConnectionState * AllocateConnection();
+
+    /**
+     * Maximum number of simultaneous connections, including the ones that may be allocated from the heap.
+     */
+    size_t MaxConnections() const { return mActiveConnectionsSize + CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS; }
+
+    /**
+     * Number of connection states that are currently allocated, whether in use or not.
+     */
+    size_t ConnectionCapacity() const;
+
+    /**
+     * Access the connection state at the given index, which must be less than ConnectionCapacity().
+     */
+    ActiveTCPConnectionState & ConnectionAt(size_t index) const;
     /**
      * Find an active connection to the given peer or return nullptr if
      * no active connection exists.
@@ -274,6 +294,13 @@ private:
      */
     void CloseConnectionInternal(ActiveTCPConnectionState * connection, CHIP_ERROR err, SuppressCallback suppressCallback);
 
+    /**
+     * Compare the send queue of a connection against CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+     * and CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK, and notify the upper layer if the connection
+     * became backpressured or the backpressure was relieved.
+     */
+    void UpdateSendBackpressure(ActiveTCPConnectionState * connection);
+
     // Close the listening socket endpoint
     void CloseListeningSocket();
 
@@ -285,6 +312,10 @@ private:
     // @see TCPEndpoint::OnConnectCompleteFunct
     static void HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR err);
 
+    // Callback handler for TCPEndPoint. Called when data was handed to the network stack.
+    // @see TCPEndpoint::OnDataSentFunct
+    static void HandleTCPEndPointDataSent(Inet::TCPEndPoint * endPoint, size_t len);
+
     // Callback handler for TCPEndPoint. Called when a connection has been closed.
     // @see TCPEndpoint::OnConnectionClosedFunct
     static void HandleTCPEndPointConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err);
@@ -313,6 +344,22 @@ private:
     ActiveTCPConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
 
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    static constexpr size_t kConnectionChunkSize = 4;
+    static constexpr size_t kMaxConnectionChunks =
+        (CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS + kConnectionChunkSize - 1) / kConnectionChunkSize;
+
+    struct ConnectionChunk
+    {
+        ActiveTCPConnectionState mConnections[kConnectionChunkSize];
+    };
+
+    // Connections allocated from the heap once mActiveConnections are all in use. Chunks are only
+    // released when the transport is destroyed, so connection pointers handed to upper layers stay valid.
+    ConnectionChunk * mConnectionChunks[kMaxConnectionChunks] = {};
+    size_t mConnectionChunkCount                              = 0;
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
 };
@@ -332,8 +379,15 @@ public:
     ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+    // Connections may be established to more peers than kActiveConnectionsSize
+    static constexpr ObjectPoolMem kPendingPacketPoolMem = ObjectPoolMem::kHeap;
+#else
+    static constexpr ObjectPoolMem kPendingPacketPoolMem = ObjectPoolMem::kInline;
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+
     ActiveTCPConnectionState mConnectionsBuffer[kActiveConnectionsSize];
-    PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
+    PoolImpl<PendingPacket, kPendingPacketSize, kPendingPacketPoolMem, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
 } // namespace Transport
@@ -53,6 +53,24 @@ namespace chip {
 #error "If TCP is enabled, the maximum number of connections cannot exceed the number of tcp endpoints"
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS
+ *
+ * @brief Maximum number of TCP connections a transport may allocate from the heap once
+ *        its CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS preallocated connections are in use.
+ *
+ *        Heap allocated connection state is kept until the transport is destroyed, so that
+ *        connection pointers held by upper layers remain valid. When this is non-zero,
+ *        packets pending connection establishment are also allocated from the heap.
+ */
+#ifndef CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS
+#define CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP ? 28 : 0)
+#endif
+
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0 && !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#error "Dynamic TCP connections require CHIP_SYSTEM_CONFIG_POOL_USE_HEAP"
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_TCP_PENDING_PACKETS
  *
@@ -63,6 +81,36 @@ namespace chip {
 #define CHIP_CONFIG_MAX_TCP_PENDING_PACKETS 4
 #endif
 
+/**
+ *  @def CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+ *
+ *  @brief
+ *    Number of bytes queued for sending on a TCP connection at which the
+ *    connection is reported as backpressured to the upper layers, so that
+ *    bulk senders can pause instead of queueing more data.
+ *
+ *    Setting this to 0 disables backpressure reporting.
+ */
+#ifndef CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+#define CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK (64 * 1024)
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+
+/**
+ *  @def CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK
+ *
+ *  @brief
+ *    Number of bytes queued for sending on a backpressured TCP connection at
+ *    or below which the backpressure is reported as relieved.
+ */
+#ifndef CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK
+#define CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK (16 * 1024)
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK
+
+#if CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK > 0 &&                                                                             \
+    CHIP_CONFIG_TCP_SEND_QUEUE_LOW_WATERMARK >= CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK
+#error "The TCP send queue low watermark must be below the high watermark"
+#endif
+
 /**
  *  @def CHIP_CONFIG_TCP_CONNECT_TIMEOUT_MSECS
  *
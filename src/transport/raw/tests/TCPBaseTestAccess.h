@@ -44,6 +44,26 @@ public:
     {
         return tcp.ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
     }
+
+    static size_t GetConnectedCount(TCPImpl & tcp)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < tcp.ConnectionCapacity(); i++)
+        {
+            count += tcp.ConnectionAt(i).IsConnected() ? 1 : 0;
+        }
+        return count;
+    }
+
+    static size_t GetPendingPacketCount(TCPImpl & tcp)
+    {
+        size_t count = 0;
+        static_cast<TCPBase &>(tcp).mPendingPackets.ForEachActiveObject([&](PendingPacket *) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    }
 };
 } // namespace Transport
 } // namespace chip
@@ -66,6 +66,40 @@ constexpr uint32_t kMessageCounter  = 18;
 
 const char PAYLOAD[] = "Hello!";
 
+// Messages large enough to fill the socket buffers in a reasonable number of sends.
+constexpr size_t kBulkMessageSize = 16000;
+constexpr int kMaxBulkMessages    = 1024;
+// Per-write limit that splits every bulk message across several partial writes.
+constexpr size_t kSendLengthLimit = 1000;
+
+uint8_t BulkMessageByte(int index, size_t offset)
+{
+    return static_cast<uint8_t>(static_cast<size_t>(index) * 7 + offset);
+}
+
+System::PacketBufferHandle EncodeTestHeader(System::PacketBufferHandle && buffer)
+{
+    VerifyOrReturnValue(!buffer.IsNull(), std::move(buffer));
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+    VerifyOrReturnValue(header.EncodeBeforeData(buffer) == CHIP_NO_ERROR, System::PacketBufferHandle());
+    return std::move(buffer);
+}
+
+System::PacketBufferHandle NewBulkMessage(int index)
+{
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kBulkMessageSize);
+    VerifyOrReturnValue(!buffer.IsNull(), buffer);
+
+    for (size_t i = 0; i < kBulkMessageSize; i++)
+    {
+        buffer->Start()[i] = BulkMessageByte(index, i);
+    }
+    buffer->SetDataLength(kBulkMessageSize);
+    return EncodeTestHeader(std::move(buffer));
+}
+
 class MockTransportMgrDelegate : public chip::TransportMgrDelegate
 {
 public:
@@ -115,6 +149,19 @@ public:
         }
     }
 
+    void HandleConnectionBackpressure(chip::Transport::ActiveTCPConnectionState * conn, bool isBackpressured) override
+    {
+        mBackpressureConnection = conn;
+        if (isBackpressured)
+        {
+            mBackpressureOnCount++;
+        }
+        else
+        {
+            mBackpressureOffCount++;
+        }
+    }
+
     void HandleConnectionClosed(chip::Transport::ActiveTCPConnectionState * conn, CHIP_ERROR conErr) override
     {
         chip::Transport::AppTCPConnectionCallbackCtxt * appConnCbCtxt = nullptr;
@@ -134,11 +181,11 @@ public:
         }
     }
 
-    void InitializeMessageTest(TCPImpl & tcp, const IPAddress & addr)
+    void InitializeMessageTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port = gChipTCPPort)
     {
         CHIP_ERROR err = tcp.Init(Transport::TcpListenParameters(mIOContext->GetTCPEndPointManager())
                                       .SetAddressType(addr.Type())
-                                      .SetListenPort(gChipTCPPort));
+                                      .SetListenPort(port));
 
         // retry a few times in case the port is somehow in use.
         // this is a WORKAROUND for flaky testing if we run tests very fast after each other.
@@ -159,7 +206,7 @@ public:
             chip::test_utils::SleepMillis(100);
             err = tcp.Init(Transport::TcpListenParameters(mIOContext->GetTCPEndPointManager())
                                .SetAddressType(addr.Type())
-                               .SetListenPort(gChipTCPPort));
+                               .SetListenPort(port));
         }
 
         EXPECT_EQ(err, CHIP_NO_ERROR);
@@ -170,6 +217,9 @@ public:
         mReceiveHandlerCallCount        = 0;
         mHandleConnectionCompleteCalled = false;
         mHandleConnectionCloseCalled    = false;
+        mBackpressureOnCount            = 0;
+        mBackpressureOffCount           = 0;
+        mBackpressureConnection         = nullptr;
 
         gAppTCPConnCbCtxt.appContext     = nullptr;
         gAppTCPConnCbCtxt.connReceivedCb = nullptr;
@@ -281,6 +331,10 @@ public:
 
     bool mHandleConnectionCloseCalled = false;
 
+    int mBackpressureOnCount                                            = 0;
+    int mBackpressureOffCount                                           = 0;
+    chip::Transport::ActiveTCPConnectionState * mBackpressureConnection = nullptr;
+
 private:
     IOContext * mIOContext;
     MessageReceivedCallback mCallback;
@@ -528,6 +582,23 @@ protected:
         }
         return 0;
     }
+
+    // Callback used by SendBackpressureTest.
+    static int BulkMessageCallbackCheck(const uint8_t * message, size_t length, int count, void * data)
+    {
+        if (length != kBulkMessageSize)
+        {
+            return -1;
+        }
+        for (size_t i = 0; i < length; i++)
+        {
+            if (message[i] != BulkMessageByte(count, i))
+            {
+                return -2;
+            }
+        }
+        return 0;
+    }
 };
 
 IOContext * TestTCP::mIOContext = nullptr;
@@ -609,6 +680,164 @@ TEST_F(TestTCP, HandleConnCloseCalledTest6)
     HandleConnCloseTest(addr);
 }
 
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS >= 2
+TEST_F(TestTCP, ConnectionsBeyondPreallocatedTest6)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Each connection to self uses two connection states, one for each end, so three
+    // connections need more than the kMaxTcpActiveConnectionCount preallocated states.
+    constexpr size_t kConnectionCount = 3;
+    Transport::ActiveTCPConnectionState * connections[kConnectionCount];
+    for (auto & connection : connections)
+    {
+        EXPECT_EQ(tcp.TCPConnect(Transport::PeerAddress::TCP(addr, gChipTCPPort), &gAppTCPConnCbCtxt, &connection),
+                  CHIP_NO_ERROR);
+    }
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5),
+                             [&tcp]() { return TestAccess::GetConnectedCount(tcp) == 2 * kConnectionCount; });
+    EXPECT_EQ(TestAccess::GetConnectedCount(tcp), 2 * kConnectionCount);
+
+    // Connection states handed out before the pool grew are still valid
+    for (auto * connection : connections)
+    {
+        EXPECT_TRUE(connection->IsConnected());
+    }
+
+    gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
+}
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS >= 2
+
+#if CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+TEST_F(TestTCP, PendingPacketsBeyondPreallocatedTest6)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Each peer that is still being connected to holds a pending packet, so sending to more peers
+    // than kMaxTcpPendingPackets at once needs the pending packet pool to allocate from the heap.
+    constexpr size_t kPeerCount = kMaxTcpPendingPackets + 1;
+    static_assert(kPeerCount <= kMaxTcpActiveConnectionCount + CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS,
+                  "The transport must be able to connect to all peers");
+
+    struct Peer
+    {
+        Peer() : mDelegate(mIOContext) {}
+
+        TCPImpl mTCP;
+        MockTransportMgrDelegate mDelegate;
+    };
+    Peer peers[kPeerCount];
+
+    for (size_t i = 0; i < kPeerCount; i++)
+    {
+        peers[i].mDelegate.InitializeMessageTest(peers[i].mTCP, addr, static_cast<uint16_t>(gChipTCPPort + 1 + i));
+        peers[i].mDelegate.SetCallback(
+            [](const uint8_t * message, size_t length, int count, void * data) { return memcmp(message, data, length); },
+            const_cast<void *>(static_cast<const void *>(PAYLOAD)));
+    }
+
+    for (size_t i = 0; i < kPeerCount; i++)
+    {
+        System::PacketBufferHandle buffer = EncodeTestHeader(System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD)));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(tcp.SendMessage(Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(gChipTCPPort + 1 + i)),
+                                  std::move(buffer)),
+                  CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(TestAccess::GetPendingPacketCount(tcp), kPeerCount);
+
+    // Every peer gets its packet once connected
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&peers]() {
+        for (auto & peer : peers)
+        {
+            if (peer.mDelegate.mReceiveHandlerCallCount == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+    for (auto & peer : peers)
+    {
+        EXPECT_EQ(peer.mDelegate.mReceiveHandlerCallCount, 1);
+    }
+    EXPECT_EQ(TestAccess::GetPendingPacketCount(tcp), 0u);
+
+    for (size_t i = 0; i < kPeerCount; i++)
+    {
+        tcp.TCPDisconnect(Transport::PeerAddress::TCP(addr, static_cast<uint16_t>(gChipTCPPort + 1 + i)));
+    }
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&tcp]() { return !tcp.HasActiveConnections(); });
+    EXPECT_FALSE(tcp.HasActiveConnections());
+}
+#endif // CHIP_CONFIG_MAX_DYNAMIC_TCP_CONNECTIONS > 0
+
+#if CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK > 0 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+TEST_F(TestTCP, SendBackpressureTest6)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.ConnectTest(tcp, addr);
+
+    Transport::PeerAddress lPeerAddress = Transport::PeerAddress::TCP(addr, gChipTCPPort);
+    void * state                        = TestAccess::FindActiveConnection(tcp, lPeerAddress);
+    ASSERT_NE(state, nullptr);
+    TCPEndPoint * lEndPoint = TestAccess::GetEndpoint(state);
+    ASSERT_NE(lEndPoint, nullptr);
+
+    // Split every write, so that sending resumes from partially sent buffers.
+    lEndPoint->SetMaxSendLengthForTesting(kSendLengthLimit);
+    gMockTransportMgrDelegate.SetCallback(BulkMessageCallbackCheck);
+
+    // Nothing reads from the other end while I/O is not serviced, so the socket buffers fill up
+    // and the messages queue on the endpoint until the connection is backpressured.
+    int sentCount = 0;
+    while (gMockTransportMgrDelegate.mBackpressureOnCount == 0 && sentCount < kMaxBulkMessages)
+    {
+        System::PacketBufferHandle buffer = NewBulkMessage(sentCount);
+        ASSERT_FALSE(buffer.IsNull());
+        ASSERT_EQ(tcp.SendMessage(lPeerAddress, std::move(buffer)), CHIP_NO_ERROR);
+        sentCount++;
+    }
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureOnCount, 1);
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureOffCount, 0);
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureConnection, state);
+    EXPECT_GE(lEndPoint->PendingSendLength(), static_cast<size_t>(CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK));
+
+    // Once the other end reads, the queue drains, the backpressure is relieved, and every message arrives intact.
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [&]() {
+        return gMockTransportMgrDelegate.mReceiveHandlerCallCount == sentCount &&
+            gMockTransportMgrDelegate.mBackpressureOffCount != 0;
+    });
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, sentCount);
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureOnCount, 1);
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureOffCount, 1);
+    EXPECT_EQ(gMockTransportMgrDelegate.mBackpressureConnection, state);
+    EXPECT_EQ(lEndPoint->PendingSendLength(), 0u);
+
+    gMockTransportMgrDelegate.SetCallback(nullptr);
+    gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
+}
+#endif // CHIP_CONFIG_TCP_SEND_QUEUE_HIGH_WATERMARK > 0 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 TEST_F(TestTCP, CheckProcessReceivedBuffer)
 {
     TCPImpl tcp;
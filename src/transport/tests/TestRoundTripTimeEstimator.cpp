@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the RoundTripTimeEstimator.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <transport/RoundTripTimeEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using chip::Transport::RoundTripTimeEstimator;
+
+TEST(TestRoundTripTimeEstimator, FirstSample)
+{
+    RoundTripTimeEstimator estimator;
+    EXPECT_FALSE(estimator.HasEstimate());
+
+    estimator.AddSample(100_ms32);
+
+    // SRTT <- R, RTTVAR <- R/2, RTO <- SRTT + 4 * RTTVAR
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSampleCount(), 1u);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 50_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 300_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, SubsequentSamples)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(100_ms32);
+    estimator.AddSample(180_ms32);
+
+    // RTTVAR <- 3/4 * 50 + 1/4 * |100 - 180| = 57.5, SRTT <- 7/8 * 100 + 1/8 * 180 = 110
+    EXPECT_EQ(estimator.GetSampleCount(), 2u);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 110_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 58_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 340_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, ConvergesOnStableRoundTrips)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(500_ms32);
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(2_ms32);
+    }
+
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 2_ms32);
+    EXPECT_LE(estimator.GetRetransmissionTimeout(), 4_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, ZeroRoundTrip)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(0_ms32);
+
+    // The clock granularity keeps the timeout from being zero.
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 0_ms32);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), 1_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, ClampsLongSamples)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+
+    EXPECT_EQ(estimator.GetSmoothedRtt(), RoundTripTimeEstimator::kMaxSample);
+    EXPECT_EQ(estimator.GetRetransmissionTimeout(), RoundTripTimeEstimator::kMaxSample + estimator.GetRttVariation() * 4);
+}
+
+TEST(TestRoundTripTimeEstimator, Reset)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(100_ms32);
+    estimator.Reset();
+
+    EXPECT_FALSE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSampleCount(), 0u);
+
+    estimator.AddSample(20_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 20_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 10_ms32);
+}
+
+} // namespace
@@ -461,5 +461,71 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, LookupByLocalKeyAndPeer)
+{
+    SecureSessionTable sessionTable;
+    sessionTable.Init();
+
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+    constexpr FabricIndex kCaseFabric = 1;
+    constexpr FabricIndex kPaseFabric = 2;
+
+    const ScopedNodeId localNode(1, kCaseFabric);
+    const ScopedNodeId casePeer(2, kCaseFabric);
+    const ScopedNodeId pasePeer(NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId), kUndefinedFabricIndex);
+
+    auto countSessionsWithPeer = [&sessionTable](const ScopedNodeId & peer) {
+        size_t count = 0;
+        sessionTable.ForEachSessionWithPeer(peer, [&count](SecureSession *) {
+            ++count;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    auto caseSession = sessionTable.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    auto paseSession = sessionTable.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(caseSession.HasValue());
+    ASSERT_TRUE(paseSession.HasValue());
+
+    uint16_t caseSessionId = caseSession.Value()->AsSecureSession()->GetLocalSessionId();
+    uint16_t paseSessionId = paseSession.Value()->AsSecureSession()->GetLocalSessionId();
+    EXPECT_NE(caseSessionId, paseSessionId);
+    EXPECT_NE(caseSessionId, kUnsecuredSessionId);
+    EXPECT_NE(paseSessionId, kUnsecuredSessionId);
+
+    // Pending sessions are found by local session ID, and have no peer yet.
+    {
+        auto found = sessionTable.FindSecureSessionByLocalKey(caseSessionId);
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_TRUE(found.Value() == caseSession.Value());
+    }
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId()), 2u);
+    EXPECT_FALSE(sessionTable.FindSecureSessionByLocalKey(static_cast<uint16_t>(caseSessionId + 100)).HasValue());
+
+    // Activation and fabric adoption move the sessions to their peer.
+    caseSession.Value()->AsSecureSession()->Activate(localNode, casePeer, CATValues(), 1, config);
+    paseSession.Value()->AsSecureSession()->Activate(ScopedNodeId(), pasePeer, CATValues(), 2, config);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId()), 0u);
+    EXPECT_EQ(countSessionsWithPeer(casePeer), 1u);
+    EXPECT_EQ(countSessionsWithPeer(pasePeer), 1u);
+
+    EXPECT_EQ(paseSession.Value()->AsSecureSession()->AdoptFabricIndex(kPaseFabric), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessionsWithPeer(pasePeer), 0u);
+    EXPECT_EQ(countSessionsWithPeer(ScopedNodeId(pasePeer.GetNodeId(), kPaseFabric)), 1u);
+
+    // Released sessions can no longer be found, and their ID becomes available again.
+    SecureSession * session = caseSession.Value()->AsSecureSession();
+    caseSession.ClearValue();
+    session->MarkForEviction();
+    EXPECT_FALSE(sessionTable.FindSecureSessionByLocalKey(caseSessionId).HasValue());
+    EXPECT_EQ(countSessionsWithPeer(casePeer), 0u);
+
+    auto found = sessionTable.FindSecureSessionByLocalKey(paseSessionId);
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_TRUE(found.Value() == paseSession.Value());
+}
+
 } // namespace Transport
 } // namespace chip
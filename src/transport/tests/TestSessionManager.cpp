@@ -118,6 +118,31 @@ public:
     bool LargeMessageSent       = false;
 };
 
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+class TestSessionConnectionDelegate : public SessionConnectionDelegate
+{
+public:
+    void OnTCPConnectionClosed(const SessionHandle & session, CHIP_ERROR conErr) override {}
+
+    void OnTCPConnectionBackpressure(const SessionHandle & session, bool isBackpressured) override
+    {
+        mSession = session->AsSecureSession();
+        if (isBackpressured)
+        {
+            mBackpressureOnCount++;
+        }
+        else
+        {
+            mBackpressureOffCount++;
+        }
+    }
+
+    SecureSession * mSession  = nullptr;
+    int mBackpressureOnCount  = 0;
+    int mBackpressureOffCount = 0;
+};
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
 class TestSessionManager : public ::testing::Test
 {
 protected:
@@ -1015,4 +1040,60 @@ TEST_F(TestSessionManager, TestFindSecureSessionForNode)
     sessionManager.Shutdown();
 }
 
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT
+TEST_F(TestSessionManager, TCPConnectionBackpressureTest)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    FabricTableHolder fabricTableHolder;
+    secure_channel::MessageCounterManager messageCounterManager;
+    TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    SessionManager sessionManager;
+    TestSessionConnectionDelegate connDelegate;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &messageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+    sessionManager.SetConnectionDelegate(&connDelegate);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::TCP(addr, CHIP_PORT));
+
+    SessionHolder tcpSession;
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.InjectCaseSessionWithTestKey(tcpSession, 1, 2, 0x11223344ull, 0x12344321ull, 1, peer,
+                                                          CryptoContext::SessionRole::kInitiator));
+    SessionHolder otherSession;
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.InjectCaseSessionWithTestKey(otherSession, 3, 4, 0x11223344ull, 0x55667788ull, 1, peer,
+                                                          CryptoContext::SessionRole::kInitiator));
+
+    ActiveTCPConnectionState conn;
+    conn.Init(nullptr, peer);
+    tcpSession->AsSecureSession()->SetTCPConnection(&conn);
+
+    // Only the session carried by the connection is told about its backpressure
+    sessionManager.HandleConnectionBackpressure(&conn, true);
+    EXPECT_EQ(connDelegate.mBackpressureOnCount, 1);
+    EXPECT_EQ(connDelegate.mBackpressureOffCount, 0);
+    EXPECT_EQ(connDelegate.mSession, tcpSession->AsSecureSession());
+
+    sessionManager.HandleConnectionBackpressure(&conn, false);
+    EXPECT_EQ(connDelegate.mBackpressureOnCount, 1);
+    EXPECT_EQ(connDelegate.mBackpressureOffCount, 1);
+    EXPECT_EQ(connDelegate.mSession, tcpSession->AsSecureSession());
+
+    ActiveTCPConnectionState otherConn;
+    otherConn.Init(nullptr, peer);
+    sessionManager.HandleConnectionBackpressure(&otherConn, true);
+    EXPECT_EQ(connDelegate.mBackpressureOnCount, 1);
+
+    tcpSession->AsSecureSession()->SetTCPConnection(nullptr);
+    sessionManager.SetConnectionDelegate(nullptr);
+    sessionManager.Shutdown();
+}
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
+
 } // namespace